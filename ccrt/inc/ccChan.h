@@ -0,0 +1,160 @@
+/*!
+ * @file  ccrt/inc/ccChan.h
+ *
+ * @brief ccrt header file for ccChan.c
+ *
+ * ccrt can simulate several converter channels. Each channel has its own libreg manager,
+ * run and simulation variables, state parameters, armed functions per cycle selector
+ * and logs. Channel 0 uses the original ccrt global variables, so with one channel ccrt
+ * behaves exactly as before. The configuration parameters (GLOBAL, LIMITS, LOAD, MEAS,
+ * BREG, IREG, PC, ...) are shared by all channels.
+ *
+ * The channels are distributed round-robin across a set of real-time threads, each pinned
+ * to a core. Every tick, a thread runs one iteration for each of its channels and records
+ * how long this took, so that the utilisation can be reported by the CHANNELS command.
+ *
+ * When ccrt runs a script, the threads are gated: they only run the iterations requested by
+ * WAIT commands, so every command is applied at an exact iteration whatever the speed of the
+ * threads. The threads can then either keep to the tick period (throttled) or run as fast as
+ * the CPU allows (free-running), and the logs are the same in both cases.
+ *
+ * <h2>Copyright</h2>
+ *
+ * Copyright CERN 2015. This project is released under the GNU Lesser General
+ * Public License version 3.
+ *
+ * <h2>License</h2>
+ *
+ * This file is part of ccrt.
+ *
+ * ccrt is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CCCHAN_H
+#define CCCHAN_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+#include "ccCmds.h"
+#include "ccRun.h"
+#include "ccSim.h"
+#include "ccLog.h"
+#include "ccGate.h"
+
+// GLOBALS should be defined in the source file where global variables should be defined
+
+#ifdef GLOBALS
+#define CCCHAN_EXT
+#else
+#define CCCHAN_EXT extern
+#endif
+
+// Constants
+
+#define CC_MAX_CHANNELS             64                  // Maximum number of simulated channels
+#define CC_MAX_RT_THREADS           16                  // Maximum number of real-time threads
+#define CC_NO_CHANNEL               0xFFFFFFFF          // No channel prefix on the command line
+
+// Channel structure - every pointer refers to the channel's own copy of the variables
+
+struct ccchan
+{
+    uint32_t                        idx;                                // Channel index
+    uint32_t                        thread_idx;                         // Index of the real-time thread that runs the channel
+    struct REG_mgr                 *reg_mgr;                            // Libreg manager
+    struct ccrun_vars              *run;                                // Run variables
+    struct ccsim_vars              *sim;                                // Simulation variables
+    struct ccpars_state            *state;                              // STATE parameters
+    struct ccpars_direct           *direct;                             // DIRECT parameters
+    struct ccpars_faults           *faults;                             // FAULTS parameters
+    struct ccpars_warnings         *warnings;                           // WARNINGS parameters
+    struct ccpars_ref              *ref;                                // REF parameters for every cycle selector
+    char                           *fg_pars[CC_NUM_CYC_SELS];           // Armed libfg parameters for every cycle selector
+    float                          *i_rms;                              // RMS current in converter
+    float                          *i_rms_load;                         // RMS current in load
+    struct cclog                   *breg_log;                           // Field regulation log
+    struct cclog                   *ireg_log;                           // Current regulation log
+    struct cclog                   *meas_log;                           // Measurement rate log
+};
+
+// Real-time thread structure
+
+struct ccchan_thread
+{
+    pthread_t                       thread;                             // Thread handle
+    uint32_t                        idx;                                // Thread index
+    uint32_t                        cpu;                                // Core to which the thread is pinned
+    uint32_t                        period_ns;                          // Tick period in nanoseconds
+    uint32_t                        num_channels;                       // Number of channels run by the thread
+    struct ccchan                  *chan[CC_MAX_CHANNELS];              // Channels run by the thread
+};
+
+// Multi-channel variables
+
+struct ccchan_vars
+{
+    uint32_t                        num_channels;                       // Number of channels
+    uint32_t                        num_threads;                        // Number of real-time threads
+    uint32_t                        cli_idx;                            // Channel index from the command line prefix [n]
+    bool                            is_gated;                           // Threads only run the iterations requested by WAIT
+    bool                            is_free_running;                    // Gated threads run as fast as possible instead of every period
+    struct ccgate                   gate;                               // Gate for the real-time threads when is_gated is set
+    struct ccchan                   chan[CC_MAX_CHANNELS];              // Channels
+    struct ccchan_thread            thread[CC_MAX_RT_THREADS];          // Real-time threads
+};
+
+CCCHAN_EXT struct ccchan_vars ccchan
+#ifdef GLOBALS
+= {
+    .num_channels = 1,
+    .num_threads  = 1,
+    .cli_idx      = CC_NO_CHANNEL,
+    .gate         = { .mutex = PTHREAD_MUTEX_INITIALIZER, .cond = PTHREAD_COND_INITIALIZER },
+    .chan         = {
+        {   // Channel 0 uses the original ccrt global variables
+            .reg_mgr    = &reg_mgr,
+            .run        = &ccrun,
+            .sim        = &ccsim,
+            .state      = &ccpars_state,
+            .direct     = &ccpars_direct,
+            .faults     = &ccpars_faults,
+            .warnings   = &ccpars_warnings,
+            .ref        = ccpars_ref,
+            .i_rms      = &i_rms,
+            .i_rms_load = &i_rms_load,
+            .breg_log   = &breg_log,
+            .ireg_log   = &ireg_log,
+            .meas_log   = &meas_log,
+        },
+    },
+}
+#endif
+;
+
+// Function prototypes
+
+uint32_t        ccChanInit              (uint32_t num_channels, uint32_t num_threads);
+uint32_t        ccChanStartThreads      (uint32_t period_ns);
+struct ccchan * ccChanCli               (void);
+bool            ccChanIsShared          (void *addr);
+void *          ccChanRelocate          (struct ccchan *chan, void *addr);
+char *          ccChanParValue          (struct CCpars *par);
+void            ccChanReport            (FILE *f);
+
+#endif
+
+// EOF
@@ -95,6 +95,7 @@ uint32_t ccCmdsRead  (uint32_t cmd_idx, char *remaining_line);
 uint32_t ccCmdsArm   (uint32_t cmd_idx, char *remaining_line);
 uint32_t ccCmdsWait  (uint32_t cmd_idx, char *remaining_line);
 uint32_t ccCmdsLog   (uint32_t cmd_idx, char *remaining_line);
+uint32_t ccCmdsChannels(uint32_t cmd_idx, char *remaining_line);
 uint32_t ccCmdsExit  (uint32_t cmd_idx, char *remaining_line);
 uint32_t ccCmdsQuit  (uint32_t cmd_idx, char *remaining_line);
 
@@ -133,6 +134,7 @@ enum cccmds_enum
     CMD_ARM,
     CMD_WAIT,
     CMD_LOG,
+    CMD_CHANNELS,
     CMD_EXIT,
     CMD_QUIT,
 
@@ -184,6 +186,7 @@ CCCMDS_EXT struct cccmds cmds[] // The order must match enum cccmds_enum (above)
     { "ARM",       ccCmdsArm  , NULL          , "[cyc_sel]  Arm reference function for cyc_sel"                     },
     { "WAIT",      ccCmdsWait , NULL          , "[seconds]  Wait specified time (default is 1s)"                    },
     { "LOG",       ccCmdsLog  , NULL          , "           Write log file with length GLOBAL LOG_DURATION"         },
+    { "CHANNELS",  ccCmdsChannels, NULL       , "           Print channel and real-time thread utilisation"         },
     { "EXIT",      ccCmdsExit , NULL          , "           Exit from current file or quit when from stdin"         },
     { "QUIT",      ccCmdsQuit , NULL          , "           Quit program immediately"                               },
     { NULL }
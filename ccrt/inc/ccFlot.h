@@ -37,7 +37,9 @@
 
 // Function declarations
 
-void     ccFlot              (FILE *f, char *filename, double time_origin);
+struct ccchan;
+
+void     ccFlot              (FILE *f, struct ccchan *chan, char *filename, double time_origin);
 
 #endif
 
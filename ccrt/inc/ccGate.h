@@ -0,0 +1,61 @@
+/*!
+ * @file  ccrt/inc/ccGate.h
+ *
+ * @brief ccrt header file for ccGate.c
+ *
+ * <h2>Copyright</h2>
+ *
+ * Copyright CERN 2015. This project is released under the GNU Lesser General
+ * Public License version 3.
+ *
+ * <h2>License</h2>
+ *
+ * This file is part of ccrt.
+ *
+ * ccrt is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CCGATE_H
+#define CCGATE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+// Constants
+
+#define CC_GATE_MAX_THREADS         16                  // Must not be less than CC_MAX_RT_THREADS
+
+// Gate that releases the real-time threads for a number of iterations when a script is run
+
+struct ccgate
+{
+    uint32_t                        num_threads;                        // Number of gated threads
+    _Atomic uint64_t                run_until_iter;                     // Gated threads stop when they reach this iteration
+    _Atomic uint64_t                num_iters[CC_GATE_MAX_THREADS];     // Number of iterations run by each thread
+    pthread_mutex_t                 mutex;                              // Mutex for run_until_iter
+    pthread_cond_t                  cond;                               // Signalled when run_until_iter changes or a thread reaches it
+};
+
+// Function prototypes
+
+uint64_t        ccGateWaitIters         (double wait_s);
+void            ccGateRunIters          (struct ccgate *gate, uint64_t num_iters);
+bool            ccGateRT                (struct ccgate *gate, uint32_t thread_idx);
+void            ccGateIterDoneRT        (struct ccgate *gate, uint32_t thread_idx);
+
+#endif
+
+// EOF
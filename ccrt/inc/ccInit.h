@@ -31,8 +31,11 @@
 
 // Function declarations
 
+struct ccchan;
+
 void     ccInitPars     (void);
-uint32_t ccInitFunction (uint32_t cyc_sel);
+void     ccInitRegMgr   (struct ccchan *chan);
+uint32_t ccInitFunction (struct ccchan *chan, uint32_t cyc_sel);
 
 #endif
 // EOF
@@ -189,8 +189,10 @@ CCLOG_EXT struct cclog meas_log
 
 // Function declarations
 
+struct ccchan;
+
 void     ccLogStoreReg          (struct cclog *log, double time);
-void     ccLogStoreMeas         (double time);
+void     ccLogStoreMeas         (struct ccchan *chan);
 uint32_t ccLogReportBadValues   (struct cclog *log);
 
 #endif
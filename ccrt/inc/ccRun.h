@@ -34,6 +34,7 @@
 #include <pthread.h>
 
 #include "pars/global.h"
+#include "ccTimeline.h"
 
 // GLOBALS should be defined in the source file where global variables should be defined
 
@@ -67,14 +68,9 @@ struct ccrun_vars
     struct FG_limits                fg_func_limits;                          // fg_limits for arming references (b/i/v)
     struct REG_lim_ref              fg_lim_v_ref;                       // Libreg voltage measurement limits structure for fg converter limits
 
-    struct ccrun_supercycle
-    {
-        pthread_mutex_t             mutex;                              // Mutex to protect the supercycle structure
-        uint32_t                    seconds_remaining;                  // Time remaining in the current cycle
-        uint32_t                    cyc_idx;                            // Index with the supercycle (ccpars_globsl.cycle_selector)
-        uint32_t                    cyc_sel;                            // Cycle selector for the current cycle
-        uint32_t                    ref_cyc_sel;                        // Cycle selector for reference generation for the current cycle
-    } supercycle;
+    uint64_t                        iter_counter;                       // Iteration counter since the real-time thread started
+
+    struct cctimeline               supercycle;                         // Supercycle timeline
 
     struct ccrun_cycle
     {
@@ -103,7 +99,9 @@ CCRUN_EXT struct ccrun_vars ccrun
 
 // Function prototypes
 
-void    ccRun   (union sigval sigval);
+struct ccchan;
+
+void    ccRunChannelRT  (struct ccchan *chan);
 
 #endif
 
@@ -0,0 +1,179 @@
+/*!
+ * @file  ccrt/inc/ccShm.h
+ *
+ * @brief ccrt header file for ccShm.c
+ *
+ * ccrt can publish the libreg variables of every channel in a POSIX shared memory segment,
+ * so that external tools can monitor them live without system calls and without disturbing
+ * the real-time threads. The segment is created with the -m option.
+ *
+ * Each channel has a snapshot of every variable in libreg_vars.h, protected by a sequence
+ * lock. The real-time thread that runs the channel is the only writer: it makes the sequence
+ * number odd, updates the snapshot and then makes it even again. A reader copies the snapshot
+ * and retries if the sequence number was odd or changed during the copy, so a reader never
+ * sees a torn snapshot and can never block the writer.
+ *
+ * This header only depends on libreg so that it can be included by the reader tool ccshm.
+ *
+ * <h2>Copyright</h2>
+ *
+ * Copyright CERN 2015. This project is released under the GNU Lesser General
+ * Public License version 3.
+ *
+ * <h2>License</h2>
+ *
+ * This file is part of ccrt.
+ *
+ * ccrt is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CCSHM_H
+#define CCSHM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <string.h>
+
+#include "libreg.h"
+
+// GLOBALS should be defined in the source file where global variables should be defined
+
+#ifdef GLOBALS
+#define CCSHM_EXT
+#else
+#define CCSHM_EXT extern
+#endif
+
+// Constants
+
+#define CC_SHM_MAGIC                0x4343534D          // "CCSM"
+#define CC_SHM_VERSION              1                   // Increment when the segment layout changes
+#define CC_SHM_MAX_CHANNELS         64                  // Must not be less than CC_MAX_CHANNELS
+
+// Snapshot of every libreg variable - one member per variable in libreg_vars.h
+
+struct ccshm_vars
+{
+#define CC_SHM_VAR(VAR_KEY, TYPE)   TYPE VAR_KEY;
+    REG_VARS_LIST(CC_SHM_VAR)
+#undef CC_SHM_VAR
+};
+
+// Channel snapshot protected by a sequence lock
+
+struct ccshm_chan
+{
+    _Atomic uint32_t                seq;                                // Sequence number - odd while the snapshot is being written
+    uint32_t                        reserved;                           // Padding so that iter_counter is aligned on all platforms
+    uint64_t                        iter_counter;                       // Channel iteration counter for the snapshot
+    double                          iter_time_s;                        // Channel iteration time for the snapshot
+    struct ccshm_vars               vars;                               // Libreg variables
+};
+
+// Shared memory segment
+
+struct ccshm_segment
+{
+    uint32_t                        magic;                              // CC_SHM_MAGIC once the segment is initialised
+    uint32_t                        version;                            // CC_SHM_VERSION
+    uint32_t                        num_channels;                       // Number of channels in use
+    uint32_t                        num_vars;                           // REG_NUM_VARS
+    uint32_t                        vars_size;                          // sizeof(struct ccshm_vars)
+    uint32_t                        reserved;                           // Padding
+    struct ccshm_chan               chan[CC_SHM_MAX_CHANNELS];          // Channel snapshots
+};
+
+CCSHM_EXT struct ccshm_segment *ccshm;                                  // NULL unless the segment was created
+
+// Function prototypes
+
+struct ccchan;
+
+uint32_t        ccShmInit               (char const *name, uint32_t num_channels);
+void            ccShmStoreRT            (struct ccchan *chan);
+
+// inline function definitions
+
+/*!
+ * Write a snapshot of a channel's variables into the shared memory segment. This must only be
+ * called by the real-time thread that runs the channel, since the sequence lock allows only one writer.
+ *
+ * @param[in,out] shm_chan         Pointer to the channel snapshot in the segment
+ * @param[in]     reg_mgr          Pointer to the libreg manager structure of the channel
+ * @param[in]     iter_counter     Channel iteration counter
+ * @param[in]     iter_time_s      Channel iteration time
+ */
+static inline void ccShmWriteRT(struct ccshm_chan *shm_chan, struct REG_mgr const *reg_mgr, uint64_t iter_counter, double iter_time_s)
+{
+    struct ccshm_vars *vars = &shm_chan->vars;
+    uint32_t           seq  = atomic_load_explicit(&shm_chan->seq, memory_order_relaxed);
+
+    // Make the sequence number odd while the snapshot is written
+
+    atomic_store_explicit(&shm_chan->seq, seq + 1, memory_order_relaxed);
+
+    atomic_thread_fence(memory_order_release);
+
+    shm_chan->iter_counter = iter_counter;
+    shm_chan->iter_time_s  = iter_time_s;
+
+#define CC_SHM_VAR(VAR_KEY, TYPE)   vars->VAR_KEY = regMgrVarP(reg_mgr, VAR_KEY);
+    REG_VARS_LIST(CC_SHM_VAR)
+#undef CC_SHM_VAR
+
+    // Make the sequence number even again to publish the snapshot
+
+    atomic_store_explicit(&shm_chan->seq, seq + 2, memory_order_release);
+}
+
+
+
+/*!
+ * Read a consistent snapshot of a channel's variables from the shared memory segment.
+ *
+ * @param[in]     shm_chan         Pointer to the channel snapshot in the segment
+ * @param[out]    copy             Pointer to the structure that receives the snapshot
+ *
+ * @returns    Number of retries that were needed because the writer was active
+ */
+static inline uint32_t ccShmRead(struct ccshm_chan const *shm_chan, struct ccshm_chan *copy)
+{
+    uint32_t num_retries = 0;
+    uint32_t seq;
+
+    for(;;)
+    {
+        seq = atomic_load_explicit(&shm_chan->seq, memory_order_acquire);
+
+        if((seq & 1) == 0)
+        {
+            memcpy(copy, shm_chan, sizeof(*copy));
+
+            atomic_thread_fence(memory_order_acquire);
+
+            if(atomic_load_explicit(&shm_chan->seq, memory_order_relaxed) == seq)
+            {
+                atomic_store_explicit(&copy->seq, seq, memory_order_relaxed);
+                return(num_retries);
+            }
+        }
+
+        num_retries++;
+    }
+}
+
+#endif
+
+// EOF
@@ -65,9 +65,12 @@ CCSIM_EXT struct ccsim_vars ccsim;
 
 // Function prototypes
 
-void    ccSimPcState            (void);
-void    ccSimPolSwitch          (void);
-void    ccSimSuperCycle         (union sigval sigval);
+struct ccchan;
+
+void    ccSimPcState            (struct ccchan *chan);
+void    ccSimPolSwitch          (struct ccchan *chan);
+void    ccSimSuperCycleInit     (struct ccchan *chan);
+void    ccSimSuperCycleRT       (struct ccchan *chan);
 
 #endif
 
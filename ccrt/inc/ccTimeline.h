@@ -0,0 +1,82 @@
+/*!
+ * @file  ccrt/inc/ccTimeline.h
+ *
+ * @brief ccrt header file for ccTimeline.c
+ *
+ * <h2>Copyright</h2>
+ *
+ * Copyright CERN 2015. This project is released under the GNU Lesser General
+ * Public License version 3.
+ *
+ * <h2>License</h2>
+ *
+ * This file is part of ccrt.
+ *
+ * ccrt is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CCTIMELINE_H
+#define CCTIMELINE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+// Constants
+
+#define CC_TIMELINE_MAX_EVENTS      16                  // Must not be less than MAX_CYCLES
+
+// Parameters used to build the timeline - the pointers are read again at the start of every supercycle
+
+struct cctimeline_pars
+{
+    uint32_t const                 *cycle_selector;                     // Cycle selectors: CCLL   CC=Cycle selector  LL=Length in seconds
+    uint32_t const                 *num_cycles;                         // Number of elements in cycle_selector
+    uint32_t const                 *test_cyc_sel;                       // Cycle selector on which to use test_ref_cyc_sel
+    uint32_t const                 *test_ref_cyc_sel;                   // Cycle selector for reference function when playing test_cyc_sel
+    uint32_t                        iters_per_second;                   // Number of iterations per second
+};
+
+// Supercycle timeline
+
+struct cctimeline
+{
+    pthread_mutex_t                 mutex;                              // Mutex to protect cyc_idx, cyc_sel and ref_cyc_sel for ccStatus
+    uint32_t                        cyc_idx;                            // Index with the supercycle (ccpars_globsl.cycle_selector)
+    uint32_t                        cyc_sel;                            // Cycle selector for the current cycle
+    uint32_t                        ref_cyc_sel;                        // Cycle selector for reference generation for the current cycle
+    uint32_t                        num_events;                         // Number of start-of-cycle events in the timeline
+    uint32_t                        event_idx;                          // Index of the next event in the timeline
+    uint32_t                        length_iters;                       // Supercycle length in iterations
+    uint64_t                        start_iter;                         // Iteration counter at the start of the current supercycle
+    uint64_t                        next_event_iter;                    // Iteration counter of the next event
+    struct cctimeline_pars          pars;                               // Parameters used to build the timeline
+
+    struct cctimeline_event
+    {
+        uint32_t                    start_iters;                        // Start of the cycle in iterations from the start of the supercycle
+        uint32_t                    cyc_idx;                            // Index with the supercycle (ccpars_globsl.cycle_selector)
+        uint32_t                    cyc_sel;                            // Cycle selector for the cycle
+        uint32_t                    ref_cyc_sel;                        // Cycle selector for reference generation for the cycle
+    } event[CC_TIMELINE_MAX_EVENTS];                                    // Start-of-cycle events sorted by start_iters
+};
+
+// Function prototypes
+
+void    ccTimelineInit          (struct cctimeline *timeline, struct cctimeline_pars const *pars, uint64_t iter_counter);
+bool    ccTimelineRT            (struct cctimeline *timeline, uint64_t iter_counter);
+
+#endif
+
+// EOF
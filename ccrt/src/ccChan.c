@@ -0,0 +1,697 @@
+/*!
+ * @file  ccrt/src/ccChan.c
+ *
+ * @brief ccrt multi-channel support
+ *
+ * Channel 0 uses the original ccrt global variables. The other channels have their own
+ * copies of the per-channel variables, which are allocated by ccChanInit(). The address
+ * of a channel 0 variable can be relocated to the same variable for another channel
+ * with ccChanRelocate(). This is used to make the STATE, DIRECT, FAULTS, WARNINGS and REF
+ * parameters address the channel given by the command line prefix [n], and to point
+ * the log signals of each channel at its own libreg manager.
+ *
+ * <h2>Copyright</h2>
+ *
+ * Copyright CERN 2015. This project is released under the GNU Lesser General
+ * Public License version 3.
+ *
+ * <h2>License</h2>
+ *
+ * This file is part of ccrt.
+ *
+ * ccrt is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define _GNU_SOURCE                         // For pthread_attr_setaffinity_np()
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <sched.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+// Include ccrt program header files
+
+#include "ccCmds.h"
+#include "ccRt.h"
+#include "ccPars.h"
+#include "ccRef.h"
+#include "ccInit.h"
+#include "ccLog.h"
+#include "ccRun.h"
+#include "ccSim.h"
+#include "ccChan.h"
+#include "ccShm.h"
+#include "ccGate.h"
+
+// The gate must have a counter for every real-time thread
+
+#if CC_MAX_RT_THREADS > CC_GATE_MAX_THREADS
+#error CC_GATE_MAX_THREADS must not be less than CC_MAX_RT_THREADS
+#endif
+
+// Constants
+
+#define TIMER_PRIORITY          0           // 0 for non-realtime Linux kernel
+#define CC_NS_PER_S             1000000000
+
+// Storage for the variables of channels 1 and above
+
+struct ccchan_storage
+{
+    struct REG_mgr                  reg_mgr;
+    struct ccrun_vars               run;
+    struct ccsim_vars               sim;
+    struct ccpars_state             state;
+    struct ccpars_direct            direct;
+    struct ccpars_faults            faults;
+    struct ccpars_warnings          warnings;
+    struct ccpars_ref               ref[CC_NUM_CYC_SELS];
+    float                           i_rms;
+    float                           i_rms_load;
+    struct cclog                    breg_log;
+    struct cclog                    ireg_log;
+    struct cclog                    meas_log;
+    struct cclog_ana_sigs           ana_breg_sigs[NUM_REG_SIGNALS];
+    struct cclog_ana_sigs           ana_ireg_sigs[NUM_REG_SIGNALS];
+    struct cclog_ana_sigs           ana_meas_sigs[NUM_ANA_SIGNALS];
+};
+
+// Per-channel variables - an address within a channel 0 variable is relocated to the same offset in the channel's copy
+
+struct ccchan_block
+{
+    char                           *base;                               // Channel 0 variable
+    size_t                          size;                               // Size of the variable
+    size_t                          chan_offset;                        // Offset in struct ccchan of the pointer to the channel's copy
+};
+
+static struct ccchan_block const ccchan_blocks[] =
+{
+    { (char *)&reg_mgr,         sizeof(struct REG_mgr),         offsetof(struct ccchan, reg_mgr)    },
+    { (char *)&ccrun,           sizeof(struct ccrun_vars),      offsetof(struct ccchan, run)        },
+    { (char *)&ccsim,           sizeof(struct ccsim_vars),      offsetof(struct ccchan, sim)        },
+    { (char *)&ccpars_state,    sizeof(struct ccpars_state),    offsetof(struct ccchan, state)      },
+    { (char *)&ccpars_direct,   sizeof(struct ccpars_direct),   offsetof(struct ccchan, direct)     },
+    { (char *)&ccpars_faults,   sizeof(struct ccpars_faults),   offsetof(struct ccchan, faults)     },
+    { (char *)&ccpars_warnings, sizeof(struct ccpars_warnings), offsetof(struct ccchan, warnings)   },
+    { (char *)ccpars_ref,       sizeof(ccpars_ref),             offsetof(struct ccchan, ref)        },
+    { (char *)&i_rms,           sizeof(float),                  offsetof(struct ccchan, i_rms)      },
+    { (char *)&i_rms_load,      sizeof(float),                  offsetof(struct ccchan, i_rms_load) },
+};
+
+#define CC_NUM_CHAN_BLOCKS      (sizeof(ccchan_blocks) / sizeof(ccchan_blocks[0]))
+
+// Real-time thread utilisation statistics
+
+struct ccchan_stats
+{
+    uint64_t                        num_ticks;                          // Number of ticks
+    uint64_t                        num_overruns;                       // Number of ticks that finished after the next tick was due
+    uint64_t                        busy_ns;                            // Total time spent running the channels
+    uint32_t                        max_busy_ns;                        // Longest tick
+};
+
+// Statistics published by each real-time thread with a sequence lock, as for the ccShm snapshots, so that
+// CHANNELS reads a consistent copy while the thread is running
+
+static struct ccchan_stats_pub
+{
+    _Atomic uint32_t                seq;                                // Sequence number - odd while the stats are being written
+    struct ccchan_stats             stats;                              // Statistics of the thread
+} ccchan_stats[CC_MAX_RT_THREADS];
+
+// Static function declarations
+
+/*!
+ * Find the per-channel variable that contains an address.
+ *
+ * @param[in]  addr         Address within a channel 0 variable
+ *
+ * @returns    Pointer to the per-channel variable block, or NULL if the address is shared by all channels
+ */
+static struct ccchan_block const * ccChanBlock(void *addr);
+
+/*!
+ * Prepare a log for a channel by copying the channel 0 signal definitions and relocating the signal sources.
+ *
+ * @param[in]  chan         Pointer to channel structure
+ * @param[out] log          Pointer to channel's log structure
+ * @param[out] ana_sigs     Pointer to channel's analogue signals array
+ * @param[in]  template     Pointer to channel 0 log structure
+ */
+static void ccChanInitLog(struct ccchan *chan, struct cclog *log, struct cclog_ana_sigs *ana_sigs, struct cclog const *template);
+
+/*!
+ * Add a number of nanoseconds to a time.
+ *
+ * @param[in,out] time      Pointer to time to adjust
+ * @param[in]     ns        Nanoseconds to add
+ */
+static void ccChanTimeAdd(struct timespec *time, uint32_t ns);
+
+/*!
+ * Calculate the number of nanoseconds from one time to another.
+ *
+ * @param[in]  from         Pointer to start time
+ * @param[in]  to           Pointer to end time
+ *
+ * @returns    Nanoseconds from start to end, which is negative if the end is before the start
+ */
+static int64_t ccChanTimeDiff(struct timespec const *from, struct timespec const *to);
+
+/*!
+ * Read a consistent copy of the statistics published by a real-time thread.
+ *
+ * @param[in]  pub          Pointer to the published statistics of the thread
+ * @param[out] stats        Pointer to the structure that receives the copy
+ */
+static void ccChanStatsRead(struct ccchan_stats_pub *pub, struct ccchan_stats *stats);
+
+/*!
+ * Publish the statistics of a real-time thread. This must only be called by the thread itself, since
+ * the sequence lock allows only one writer.
+ *
+ * @param[out] pub          Pointer to the published statistics of the thread
+ * @param[in]  stats        Pointer to the thread's statistics
+ */
+static void ccChanStatsStoreRT(struct ccchan_stats_pub *pub, struct ccchan_stats const *stats);
+
+/*!
+ * Real-time thread function. Every tick, this runs one iteration for each channel of the thread
+ * and records how long this took.
+ *
+ * @param[in]  arg          Pointer to thread structure
+ *
+ * @returns    Never returns
+ */
+static void * ccChanThreadRT(void *arg);
+
+
+
+// Background functions - do not call these from the real-time thread or interrupt
+
+uint32_t ccChanInit(uint32_t num_channels, uint32_t num_threads)
+{
+    uint32_t    chan_idx;
+    uint32_t    cyc_sel;
+    uint32_t    func_idx;
+    size_t      fg_pars_size = 0;
+
+    if(num_channels < 1 || num_channels > CC_MAX_CHANNELS)
+    {
+        printf("Error - number of channels (%u) must be 1-%u\n", num_channels, CC_MAX_CHANNELS);
+        return(EXIT_FAILURE);
+    }
+
+    if(num_threads < 1 || num_threads > CC_MAX_RT_THREADS || num_threads > num_channels)
+    {
+        printf("Error - number of real-time threads (%u) must be 1-%u and not more than the number of channels\n",
+                num_threads, CC_MAX_RT_THREADS);
+        return(EXIT_FAILURE);
+    }
+
+    ccchan.num_channels = num_channels;
+    ccchan.num_threads  = num_threads;
+
+    ccchan.gate.num_threads = num_threads;
+
+    // Every channel can hold the armed parameters for any function type
+
+    for(func_idx = FG_PLEP ; func_idx <= FG_PULSE ; func_idx++)
+    {
+        if(funcs[func_idx].size_of_pars > fg_pars_size)
+        {
+            fg_pars_size = funcs[func_idx].size_of_pars;
+        }
+    }
+
+    for(chan_idx = 0 ; chan_idx < num_channels ; chan_idx++)
+    {
+        struct ccchan        *chan = &ccchan.chan[chan_idx];
+        struct ccchan_thread *thread;
+
+        chan->idx = chan_idx;
+
+        // Channels 1 and above start as a copy of channel 0, which has read the config and armed the functions
+
+        if(chan_idx > 0)
+        {
+            struct ccchan          *chan0   = &ccchan.chan[0];
+            struct ccchan_storage  *storage = calloc(1, sizeof(struct ccchan_storage));
+
+            if(storage == NULL)
+            {
+                printf("Error - failed to allocate memory for channel %u\n", chan_idx);
+                return(EXIT_FAILURE);
+            }
+
+            chan->reg_mgr    = &storage->reg_mgr;
+            chan->run        = &storage->run;
+            chan->sim        = &storage->sim;
+            chan->state      = &storage->state;
+            chan->direct     = &storage->direct;
+            chan->faults     = &storage->faults;
+            chan->warnings   = &storage->warnings;
+            chan->ref        = storage->ref;
+            chan->i_rms      = &storage->i_rms;
+            chan->i_rms_load = &storage->i_rms_load;
+            chan->breg_log   = &storage->breg_log;
+            chan->ireg_log   = &storage->ireg_log;
+            chan->meas_log   = &storage->meas_log;
+
+            *chan->run      = *chan0->run;
+            *chan->sim      = *chan0->sim;
+            *chan->state    = *chan0->state;
+            *chan->direct   = *chan0->direct;
+            *chan->faults   = *chan0->faults;
+            *chan->warnings = *chan0->warnings;
+
+            memcpy(chan->ref, chan0->ref, sizeof(storage->ref));
+
+            pthread_mutex_init(&chan->run->supercycle.mutex, NULL);
+
+            // Copy the armed functions from channel 0
+
+            for(cyc_sel = 0 ; cyc_sel <= CC_MAX_CYC_SEL ; cyc_sel++)
+            {
+                chan->fg_pars[cyc_sel] = calloc(1, fg_pars_size);
+
+                if(chan->fg_pars[cyc_sel] == NULL)
+                {
+                    printf("Error - failed to allocate memory for channel %u\n", chan_idx);
+                    return(EXIT_FAILURE);
+                }
+
+                if(chan0->fg_pars[cyc_sel] != NULL)
+                {
+                    memcpy(chan->fg_pars[cyc_sel], chan0->fg_pars[cyc_sel], funcs[chan->ref[cyc_sel].armed_function].size_of_pars);
+                }
+            }
+
+            // The libreg manager contains pointers to itself so it must be initialised rather than copied
+
+            ccInitRegMgr(chan);
+            regMgrPars(chan->reg_mgr);
+            regMgrSimInit(chan->reg_mgr, REG_NONE, 0.0);
+
+            ccChanInitLog(chan, chan->breg_log, storage->ana_breg_sigs, chan0->breg_log);
+            ccChanInitLog(chan, chan->ireg_log, storage->ana_ireg_sigs, chan0->ireg_log);
+            ccChanInitLog(chan, chan->meas_log, storage->ana_meas_sigs, chan0->meas_log);
+        }
+
+        // Prepare the supercycle timeline for the channel
+
+        ccSimSuperCycleInit(chan);
+
+        // Distribute the channels round-robin across the real-time threads
+
+        chan->thread_idx = chan_idx % num_threads;
+
+        thread = &ccchan.thread[chan->thread_idx];
+
+        thread->chan[thread->num_channels++] = chan;
+    }
+
+    return(EXIT_SUCCESS);
+}
+
+
+
+uint32_t ccChanStartThreads(uint32_t period_ns)
+{
+    uint32_t            thread_idx;
+    uint32_t            num_cpus = (uint32_t)sysconf(_SC_NPROCESSORS_ONLN);
+    pthread_attr_t      thread_attr;
+    cpu_set_t           cpu_set;
+    int                 error;
+#if TIMER_PRIORITY != 0
+    struct sched_param  thread_param;
+#endif
+
+    if(num_cpus < 1)
+    {
+        num_cpus = 1;
+    }
+
+    for(thread_idx = 0 ; thread_idx < ccchan.num_threads ; thread_idx++)
+    {
+        struct ccchan_thread *thread = &ccchan.thread[thread_idx];
+
+        thread->idx       = thread_idx;
+        thread->cpu       = thread_idx % num_cpus;
+        thread->period_ns = period_ns;
+
+        // Configure thread attributes
+
+        pthread_attr_init(&thread_attr);
+
+#if TIMER_PRIORITY == 0
+        pthread_attr_setinheritsched(&thread_attr, PTHREAD_INHERIT_SCHED);
+#else
+        pthread_attr_setinheritsched(&thread_attr, PTHREAD_EXPLICIT_SCHED);
+        pthread_attr_setschedpolicy( &thread_attr, SCHED_FIFO);
+
+        sched_getparam(getpid(), &thread_param);
+        thread_param.sched_priority = TIMER_PRIORITY;
+        pthread_attr_setschedparam(&thread_attr, &thread_param);
+#endif
+
+        // Pin the thread to a core
+
+        CPU_ZERO(&cpu_set);
+        CPU_SET(thread->cpu, &cpu_set);
+
+        pthread_attr_setaffinity_np(&thread_attr, sizeof(cpu_set), &cpu_set);
+
+        // Start the thread
+
+        error = pthread_create(&thread->thread, &thread_attr, ccChanThreadRT, thread);
+
+        pthread_attr_destroy(&thread_attr);
+
+        if(error != 0)
+        {
+            printf("Error - pthread_create for real-time thread %u : %s (%d)\n", thread_idx, strerror(error), error);
+            return(EXIT_FAILURE);
+        }
+    }
+
+    return(EXIT_SUCCESS);
+}
+
+
+
+struct ccchan * ccChanCli(void)
+{
+    return(&ccchan.chan[ccchan.cli_idx == CC_NO_CHANNEL ? 0 : ccchan.cli_idx]);
+}
+
+
+
+bool ccChanIsShared(void *addr)
+{
+    return(ccChanBlock(addr) == NULL);
+}
+
+
+
+void * ccChanRelocate(struct ccchan *chan, void *addr)
+{
+    struct ccchan_block const *block = ccChanBlock(addr);
+    char                      *chan_base;
+
+    // Addresses that are not in a per-channel variable are shared by all channels
+
+    if(block == NULL)
+    {
+        return(addr);
+    }
+
+    chan_base = *(char **)((char *)chan + block->chan_offset);
+
+    return(chan_base + ((char *)addr - block->base));
+}
+
+
+
+char * ccChanParValue(struct CCpars *par)
+{
+    return(ccChanRelocate(ccChanCli(), par->value_p.c));
+}
+
+
+
+void ccChanReport(FILE *f)
+{
+    uint32_t    thread_idx;
+    uint32_t    freq_idx;
+    uint64_t    total_busy_ns      = 0;
+    uint64_t    total_chan_ticks   = 0;
+    double      max_chan_tick_ns   = 0.0;
+    uint32_t    const freq_hz[]    = { 1000, 10000 };
+
+    fprintf(f, "%u channel%s on %u real-time thread%s\n\n",
+            ccchan.num_channels, ccchan.num_channels == 1 ? "" : "s",
+            ccchan.num_threads,  ccchan.num_threads  == 1 ? "" : "s");
+
+    fprintf(f, "Thread CPU Channels  Period(us)       Ticks  Overruns  Util(%%)  Mean(us)   Max(us)\n");
+
+    for(thread_idx = 0 ; thread_idx < ccchan.num_threads ; thread_idx++)
+    {
+        struct ccchan_thread *thread = &ccchan.thread[thread_idx];
+        struct ccchan_stats   stats;
+        double                mean_ns;
+
+        ccChanStatsRead(&ccchan_stats[thread_idx], &stats);
+
+        if(stats.num_ticks == 0)
+        {
+            fprintf(f, "%6u %3u %8u %11.1f %11s\n", thread_idx, thread->cpu, thread->num_channels, thread->period_ns * 1.0E-3, "-");
+            continue;
+        }
+
+        mean_ns = (double)stats.busy_ns / (double)stats.num_ticks;
+
+        fprintf(f, "%6u %3u %8u %11.1f %11llu %9llu %8.2f %9.2f %9.2f\n",
+                thread_idx,
+                thread->cpu,
+                thread->num_channels,
+                thread->period_ns * 1.0E-3,
+                (unsigned long long)stats.num_ticks,
+                (unsigned long long)stats.num_overruns,
+                100.0 * mean_ns / thread->period_ns,
+                mean_ns * 1.0E-3,
+                stats.max_busy_ns * 1.0E-3);
+
+        total_busy_ns    += stats.busy_ns;
+        total_chan_ticks += stats.num_ticks * thread->num_channels;
+
+        if((double)stats.max_busy_ns / thread->num_channels > max_chan_tick_ns)
+        {
+            max_chan_tick_ns = (double)stats.max_busy_ns / thread->num_channels;
+        }
+    }
+
+    if(total_chan_ticks == 0)
+    {
+        return;
+    }
+
+    // Estimate the maximum number of channels for each rate from the mean and worst case cost of one channel iteration
+
+    fprintf(f, "\nChannel iteration cost: mean %.2f us  worst case %.2f us\n",
+            (double)total_busy_ns / total_chan_ticks * 1.0E-3, max_chan_tick_ns * 1.0E-3);
+
+    for(freq_idx = 0 ; freq_idx < sizeof(freq_hz) / sizeof(freq_hz[0]) ; freq_idx++)
+    {
+        double period_ns = (double)CC_NS_PER_S / freq_hz[freq_idx];
+
+        fprintf(f, "Max channels at %5u Hz: %6u per thread (mean) %6u per thread (worst case) x %u thread%s\n",
+                freq_hz[freq_idx],
+                (uint32_t)(period_ns * total_chan_ticks / total_busy_ns),
+                (uint32_t)(period_ns / max_chan_tick_ns),
+                ccchan.num_threads, ccchan.num_threads == 1 ? "" : "s");
+    }
+}
+
+
+
+static struct ccchan_block const * ccChanBlock(void *addr)
+{
+    uint32_t    block_idx;
+    char       *c_addr = addr;
+
+    for(block_idx = 0 ; block_idx < CC_NUM_CHAN_BLOCKS ; block_idx++)
+    {
+        struct ccchan_block const *block = &ccchan_blocks[block_idx];
+
+        if(c_addr >= block->base && c_addr < block->base + block->size)
+        {
+            return(block);
+        }
+    }
+
+    return(NULL);
+}
+
+
+
+static void ccChanInitLog(struct ccchan *chan, struct cclog *log, struct cclog_ana_sigs *ana_sigs, struct cclog const *template)
+{
+    uint32_t sig_idx;
+
+    log->ana_sigs          = ana_sigs;
+    log->num_ana_signals   = template->num_ana_signals;
+    log->last_sample_index = 0;
+    log->last_sample_time  = 0.0;
+
+    for(sig_idx = 0 ; sig_idx < log->num_ana_signals ; sig_idx++)
+    {
+        ana_sigs[sig_idx].name             = template->ana_sigs[sig_idx].name;
+        ana_sigs[sig_idx].is_trailing_step = template->ana_sigs[sig_idx].is_trailing_step;
+        ana_sigs[sig_idx].source           = ccChanRelocate(chan, (void *)template->ana_sigs[sig_idx].source);
+        ana_sigs[sig_idx].num_bad_values   = 0;
+    }
+}
+
+
+
+static void ccChanTimeAdd(struct timespec *time, uint32_t ns)
+{
+    time->tv_nsec += ns;
+
+    while(time->tv_nsec >= CC_NS_PER_S)
+    {
+        time->tv_nsec -= CC_NS_PER_S;
+        time->tv_sec++;
+    }
+}
+
+
+
+static int64_t ccChanTimeDiff(struct timespec const *from, struct timespec const *to)
+{
+    return((int64_t)(to->tv_sec - from->tv_sec) * CC_NS_PER_S + (to->tv_nsec - from->tv_nsec));
+}
+
+
+
+static void ccChanStatsRead(struct ccchan_stats_pub *pub, struct ccchan_stats *stats)
+{
+    uint32_t seq;
+
+    for(;;)
+    {
+        seq = atomic_load_explicit(&pub->seq, memory_order_acquire);
+
+        if((seq & 1) == 0)
+        {
+            *stats = pub->stats;
+
+            atomic_thread_fence(memory_order_acquire);
+
+            if(atomic_load_explicit(&pub->seq, memory_order_relaxed) == seq)
+            {
+                return;
+            }
+        }
+    }
+}
+
+
+
+// Real-Time Functions
+
+static void ccChanStatsStoreRT(struct ccchan_stats_pub *pub, struct ccchan_stats const *stats)
+{
+    uint32_t seq = atomic_load_explicit(&pub->seq, memory_order_relaxed);
+
+    // Make the sequence number odd while the stats are written
+
+    atomic_store_explicit(&pub->seq, seq + 1, memory_order_relaxed);
+
+    atomic_thread_fence(memory_order_release);
+
+    pub->stats = *stats;
+
+    // Make the sequence number even again to publish the stats
+
+    atomic_store_explicit(&pub->seq, seq + 2, memory_order_release);
+}
+
+
+
+
+static void * ccChanThreadRT(void *arg)
+{
+    struct ccchan_thread *thread = arg;
+    struct ccchan_stats   stats  = { 0 };
+    struct timespec       next_tick;
+    struct timespec       start;
+    struct timespec       end;
+    uint32_t              chan_idx;
+    uint32_t              busy_ns;
+    bool                  free_running = ccchan.is_gated && ccchan.is_free_running;   // Only gated threads can free-run
+
+    clock_gettime(CLOCK_MONOTONIC, &next_tick);
+
+    for(;;)
+    {
+        // When gated, restart the ticks from now after waiting for the command thread
+
+        if(ccchan.is_gated && ccGateRT(&ccchan.gate, thread->idx))
+        {
+            clock_gettime(CLOCK_MONOTONIC, &next_tick);
+        }
+
+        // Wait for the next tick unless free-running
+
+        if(free_running == false)
+        {
+            ccChanTimeAdd(&next_tick, thread->period_ns);
+
+            while(clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next_tick, NULL) == EINTR);
+        }
+
+        // Run one iteration for every channel of the thread
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+
+        for(chan_idx = 0 ; chan_idx < thread->num_channels ; chan_idx++)
+        {
+            ccRunChannelRT(thread->chan[chan_idx]);
+
+            if(ccshm != NULL)
+            {
+                ccShmStoreRT(thread->chan[chan_idx]);
+            }
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        ccGateIterDoneRT(&ccchan.gate, thread->idx);
+
+        // Record utilisation
+
+        busy_ns = (uint32_t)ccChanTimeDiff(&start, &end);
+
+        stats.num_ticks++;
+        stats.busy_ns += busy_ns;
+
+        if(busy_ns > stats.max_busy_ns)
+        {
+            stats.max_busy_ns = busy_ns;
+        }
+
+        // If the next tick is already due then count an overrun and restart the ticks from now rather than run a burst of late ticks
+
+        if(free_running == false && ccChanTimeDiff(&next_tick, &end) >= (int64_t)thread->period_ns)
+        {
+            stats.num_overruns++;
+            next_tick = end;
+        }
+
+        ccChanStatsStoreRT(&ccchan_stats[thread->idx], &stats);
+    }
+
+    return(NULL);
+}
+
+// EOF
@@ -45,12 +45,22 @@
 #include "ccInit.h"
 #include "ccRun.h"
 #include "ccStatus.h"
+#include "ccChan.h"
+#include "ccGate.h"
 
 
 
 
 uint32_t ccCmdsPar(uint32_t cmd_idx, char *remaining_line)
 {
+    // A channel prefix is only meaningful for per-channel parameters
+
+    if(ccchan.cli_idx != CC_NO_CHANNEL && ccChanIsShared(cmds[cmd_idx].pars[0].value_p.c))
+    {
+        ccParsPrintError("%s parameters are shared by all channels", cmds[cmd_idx].name);
+        return(EXIT_FAILURE);
+    }
+
     // If no parameter name provided then print all parameter values
 
     if(remaining_line == NULL)
@@ -87,7 +97,12 @@ uint32_t ccCmdsPar(uint32_t cmd_idx, char *remaining_line)
 
             if(cmd_idx > 0 && (par_matched->flags & PARS_REG) != 0)
             {
-                regMgrPars(&reg_mgr);
+                uint32_t chan_idx;
+
+                for(chan_idx = 0 ; chan_idx < ccchan.num_channels ; chan_idx++)
+                {
+                    regMgrPars(ccchan.chan[chan_idx].reg_mgr);
+                }
             }
 
             // If reading from stdin and a configuration parameter is changed then store it in a file
@@ -267,7 +282,7 @@ uint32_t ccCmdsArm(uint32_t cmd_idx, char *remaining_line)
     {
         for(cyc_sel = 0 ; cyc_sel <= CC_MAX_CYC_SEL ; cyc_sel++)
         {
-            ccInitFunction(cyc_sel);
+            ccInitFunction(ccChanCli(), cyc_sel);
         }
     }
     else    // Treat arguments as a series of cycle selectors
@@ -286,7 +301,7 @@ uint32_t ccCmdsArm(uint32_t cmd_idx, char *remaining_line)
 
             // Try to arm function for this cycle selector
 
-            if(ccInitFunction(cyc_sel) == EXIT_FAILURE)
+            if(ccInitFunction(ccChanCli(), cyc_sel) == EXIT_FAILURE)
             {
                 return(EXIT_FAILURE);
             }
@@ -300,7 +315,9 @@ uint32_t ccCmdsArm(uint32_t cmd_idx, char *remaining_line)
 uint32_t ccCmdsWait(uint32_t cmd_idx, char *remaining_line)
 {
     char      *arg;
+    double     sleep_time_s;
     useconds_t sleep_time_us;
+    uint64_t   num_iters;
 
     // If no arguments provided, try to arm every cycle selector
 
@@ -308,7 +325,7 @@ uint32_t ccCmdsWait(uint32_t cmd_idx, char *remaining_line)
     {
         // Default is 1s
 
-        sleep_time_us = 1000000;
+        sleep_time_s = 1.0;
     }
     else    // Treat arguments as a series of cycle selectors
     {
@@ -330,9 +347,28 @@ uint32_t ccCmdsWait(uint32_t cmd_idx, char *remaining_line)
             return(EXIT_FAILURE);
         }
 
-        sleep_time_us = (useconds_t)(value * 1000000);
+        sleep_time_s = value;
+    }
+
+    // When running a script, the real-time threads are gated so release them for the
+    // equivalent number of iterations and wait until they have all been run
+
+    if(ccchan.is_gated)
+    {
+        num_iters = ccGateWaitIters(sleep_time_s);
+
+        if(num_iters == 0)
+        {
+            ccParsPrintError("sleep time (%g s) is shorter than half an iteration period", sleep_time_s);
+            return(EXIT_FAILURE);
+        }
+
+        ccGateRunIters(&ccchan.gate, num_iters);
+        return(EXIT_SUCCESS);
     }
 
+    sleep_time_us = (useconds_t)(sleep_time_s * 1000000 + 0.5);
+
     // Adjust sleep time when running from script faster than real-time
 
     if(ccfile.using_stdin == false)
@@ -365,9 +401,23 @@ uint32_t ccCmdsLog(uint32_t cmd_idx, char *remaining_line)
 
     // Check if any bad values have been seend
 
-    ccLogReportBadValues(&breg_log);
-    ccLogReportBadValues(&ireg_log);
-    ccLogReportBadValues(&meas_log);
+    ccLogReportBadValues(ccChanCli()->breg_log);
+    ccLogReportBadValues(ccChanCli()->ireg_log);
+    ccLogReportBadValues(ccChanCli()->meas_log);
+
+    return(EXIT_SUCCESS);
+}
+
+
+
+uint32_t ccCmdsChannels(uint32_t cmd_idx, char *remaining_line)
+{
+    if(ccParseNoMoreArgs(&remaining_line) == EXIT_FAILURE)
+    {
+        return(EXIT_FAILURE);
+    }
+
+    ccChanReport(stdout);
 
     return(EXIT_SUCCESS);
 }
@@ -44,6 +44,7 @@
 #include "ccFlot.h"
 #include "ccRun.h"
 #include "ccRef.h"
+#include "ccChan.h"
 
 
 
@@ -178,7 +179,7 @@ uint32_t ccFileWriteLog(void)
 
     // Create Flot chart for period up to the current moment
 
-    ccFlot(log_file, ccfile.converter, ccrun.iter_time_s);
+    ccFlot(log_file, ccChanCli(), ccfile.converter, ccChanCli()->run->iter_time_s);
 
     fclose(log_file);
 
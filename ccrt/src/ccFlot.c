@@ -34,14 +34,15 @@
 #include "ccRun.h"
 #include "ccLog.h"
 #include "ccFlot.h"
+#include "ccChan.h"
 #include "flot.h"
 
 
 
-static void ccFlotAnalog(FILE *f, struct cclog *log, double time_origin, uint32_t period_iters)
+static void ccFlotAnalog(FILE *f, struct ccchan *chan, struct cclog *log, double time_origin, uint32_t period_iters)
 {
     uint32_t       sig_idx;
-    double         period       = (double)period_iters * reg_mgr.iter_period;
+    double         period       = (double)period_iters * chan->reg_mgr->iter_period;
     uint32_t       num_periods  = (uint32_t)(ccpars_global.log_duration / period) - 1;
 
     // Write each signal in the log
@@ -88,7 +89,7 @@ static void ccFlotAnalog(FILE *f, struct cclog *log, double time_origin, uint32_
 
 
 
-void ccFlot(FILE *f, char *converter_name, double time_origin)
+void ccFlot(FILE *f, struct ccchan *chan, char *converter_name, double time_origin)
 {
     // Print start of FLOT html page including flot path to all the javascript libraries
 
@@ -96,9 +97,9 @@ void ccFlot(FILE *f, char *converter_name, double time_origin)
 
     // Print enabled analog signal values
 
-    ccFlotAnalog(f, &breg_log, time_origin, reg_mgr.b.reg_period_iters);
-    ccFlotAnalog(f, &ireg_log, time_origin, reg_mgr.i.reg_period_iters);
-    ccFlotAnalog(f, &meas_log, time_origin, 1);
+    ccFlotAnalog(f, chan, chan->breg_log, time_origin, chan->reg_mgr->b.reg_period_iters);
+    ccFlotAnalog(f, chan, chan->ireg_log, time_origin, chan->reg_mgr->i.reg_period_iters);
+    ccFlotAnalog(f, chan, chan->meas_log, time_origin, 1);
 
     // Print the rest of the web page
 
@@ -0,0 +1,122 @@
+/*!
+ * @file  ccrt/src/ccGate.c
+ *
+ * @brief ccrt gate functions for the real-time threads
+ *
+ * <h2>Copyright</h2>
+ *
+ * Copyright CERN 2015. This project is released under the GNU Lesser General
+ * Public License version 3.
+ *
+ * <h2>License</h2>
+ *
+ * This file is part of ccrt.
+ *
+ * ccrt is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+// Include ccrt program header files
+
+#include "ccRt.h"
+#include "ccGate.h"
+
+
+
+// Background functions - do not call these from the real-time thread or interrupt
+
+uint64_t ccGateWaitIters(double wait_s)
+{
+    // Round to the nearest iteration so that a wait of a whole number of periods is never one iteration short
+
+    return((uint64_t)(wait_s * CC_ITERS_PER_SECOND + 0.5));
+}
+
+
+
+void ccGateRunIters(struct ccgate *gate, uint64_t num_iters)
+{
+    uint32_t thread_idx = 0;
+    uint64_t run_until_iter;
+
+    pthread_mutex_lock(&gate->mutex);
+
+    // Release the threads for the requested number of iterations
+
+    run_until_iter = atomic_load(&gate->run_until_iter) + num_iters;
+
+    atomic_store(&gate->run_until_iter, run_until_iter);
+
+    pthread_cond_broadcast(&gate->cond);
+
+    // Wait for every thread to reach the gate again
+
+    while(thread_idx < gate->num_threads)
+    {
+        if(atomic_load(&gate->num_iters[thread_idx]) < run_until_iter)
+        {
+            pthread_cond_wait(&gate->cond, &gate->mutex);
+        }
+        else
+        {
+            thread_idx++;
+        }
+    }
+
+    pthread_mutex_unlock(&gate->mutex);
+}
+
+
+
+// Real-Time Functions
+
+bool ccGateRT(struct ccgate *gate, uint32_t thread_idx)
+{
+    uint64_t num_iters = atomic_load(&gate->num_iters[thread_idx]);
+
+    if(num_iters < atomic_load(&gate->run_until_iter))
+    {
+        return(false);
+    }
+
+    pthread_mutex_lock(&gate->mutex);
+
+    // Tell the command thread that this thread has reached the gate, then wait for more iterations
+
+    pthread_cond_broadcast(&gate->cond);
+
+    while(num_iters >= atomic_load(&gate->run_until_iter))
+    {
+        pthread_cond_wait(&gate->cond, &gate->mutex);
+    }
+
+    pthread_mutex_unlock(&gate->mutex);
+
+    return(true);
+}
+
+
+
+void ccGateIterDoneRT(struct ccgate *gate, uint32_t thread_idx)
+{
+    // Only the thread itself writes its counter
+
+    atomic_store(&gate->num_iters[thread_idx], atomic_load(&gate->num_iters[thread_idx]) + 1);
+}
+
+// EOF
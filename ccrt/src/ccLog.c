@@ -35,6 +35,7 @@
 #include "ccRun.h"
 #include "ccLog.h"
 #include "ccFlot.h"
+#include "ccChan.h"
 
 
 
@@ -75,17 +76,19 @@ void ccLogStoreReg(struct cclog *log, double iter_time)
 
 
 
-void ccLogStoreMeas(double iter_time)
+void ccLogStoreMeas(struct ccchan *chan)
 {
-    meas_log.last_sample_time  = iter_time;
-    meas_log.last_sample_index = (meas_log.last_sample_index + 1 ) % CC_LOG_LENGTH;
+    struct cclog *log = chan->meas_log;
+
+    log->last_sample_time  = chan->run->iter_time_s;
+    log->last_sample_index = (log->last_sample_index + 1 ) % CC_LOG_LENGTH;
 
     // Take square room for RMS signals before they are logged
 
-    i_rms      = sqrtf(reg_mgr.lim_i_rms.meas2_filter);
-    i_rms_load = sqrtf(reg_mgr.lim_i_rms_load.meas2_filter);
+    *chan->i_rms      = sqrtf(chan->reg_mgr->lim_i_rms.meas2_filter);
+    *chan->i_rms_load = sqrtf(chan->reg_mgr->lim_i_rms_load.meas2_filter);
 
-    ccLogStoreSignals(&meas_log);
+    ccLogStoreSignals(log);
 }
 
 
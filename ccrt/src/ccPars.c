@@ -43,6 +43,7 @@
 #include "ccFile.h"
 #include "ccRef.h"
 #include "ccRun.h"
+#include "ccChan.h"
 
 
 
@@ -163,7 +164,7 @@ uint32_t ccParsGet(char *cmd_name, struct CCpars *par, char *remaining_line)
 
             for(cyc_sel = cyc_sel_from ; cyc_sel <= cyc_sel_to ; cyc_sel++)
             {
-                value_p.c = par->value_p.c + cyc_sel * par->cyc_sel_step;
+                value_p.c = ccChanParValue(par) + cyc_sel * par->cyc_sel_step;
                 value_p.u[array_idx] = (uint32_t)int_value;
             }
             break;
@@ -183,7 +184,7 @@ uint32_t ccParsGet(char *cmd_name, struct CCpars *par, char *remaining_line)
 
             for(cyc_sel = cyc_sel_from ; cyc_sel <= cyc_sel_to ; cyc_sel++)
             {
-                value_p.c = par->value_p.c + cyc_sel * par->cyc_sel_step;
+                value_p.c = ccChanParValue(par) + cyc_sel * par->cyc_sel_step;
                 value_p.f[array_idx] = (float)double_value;
             }
             break;
@@ -204,7 +205,7 @@ uint32_t ccParsGet(char *cmd_name, struct CCpars *par, char *remaining_line)
 
             for(cyc_sel = cyc_sel_from ; cyc_sel <= cyc_sel_to ; cyc_sel++)
             {
-                value_p.c = par->value_p.c + cyc_sel * par->cyc_sel_step;
+                value_p.c = ccChanParValue(par) + cyc_sel * par->cyc_sel_step;
                 free(value_p.s[array_idx]);
                 value_p.s[array_idx] = strcpy(malloc(arg_len+1),arg);
             }
@@ -257,7 +258,7 @@ uint32_t ccParsGet(char *cmd_name, struct CCpars *par, char *remaining_line)
 
             for(cyc_sel = cyc_sel_from ; cyc_sel <= cyc_sel_to ; cyc_sel++)
             {
-                value_p.c = par->value_p.c + cyc_sel * par->cyc_sel_step;
+                value_p.c = ccChanParValue(par) + cyc_sel * par->cyc_sel_step;
                 value_p.u[array_idx] = par_enum_matched->value;
             }
             break;
@@ -299,7 +300,7 @@ uint32_t ccParsGet(char *cmd_name, struct CCpars *par, char *remaining_line)
             if(array_idx < num_elements &&
               (ccfile.array_idx == CC_NO_INDEX || array_idx > (ccfile.array_idx + 1)))
             {
-                value_p.c = par->value_p.c + cyc_sel * par->cyc_sel_step;
+                value_p.c = ccChanParValue(par) + cyc_sel * par->cyc_sel_step;
 
                 memset(&value_p.c[ccpars_sizeof_type[par->type] * array_idx],
                        0,
@@ -352,7 +353,7 @@ static void ccParsPrintElement(FILE *f, struct CCpars *par, uint32_t cyc_sel, ui
     {
         union CCvalue_p value_p;
 
-        value_p.c = par->value_p.c + cyc_sel * par->cyc_sel_step;
+        value_p.c = ccChanParValue(par) + cyc_sel * par->cyc_sel_step;
 
         switch(par->type)
         {
@@ -37,6 +37,7 @@
 #include "ccRt.h"
 #include "ccParse.h"
 #include "ccFile.h"
+#include "ccChan.h"
 
 
 
@@ -184,6 +185,24 @@ uint32_t ccParseLine(char *line)
 
     ccfile.empty_line = false;
 
+    // An optional channel prefix [n] selects the channel addressed by the command
+
+    ccchan.cli_idx = CC_NO_CHANNEL;
+
+    if(*command == '[')
+    {
+        remaining_string = command + 1;
+
+        if(ccParseIndex(&remaining_string, ']', &ccchan.cli_idx) == EXIT_FAILURE || ccchan.cli_idx >= ccchan.num_channels)
+        {
+            ccchan.cli_idx = CC_NO_CHANNEL;
+            ccParsPrintError("invalid channel prefix (channels 0-%u)", ccchan.num_channels - 1);
+            return(EXIT_FAILURE);
+        }
+
+        remaining_string = command = remaining_string + strspn(remaining_string, " \t");
+    }
+
     // Initialise cycle selectors and array indexes
 
     ccfile.cyc_sel   = CC_NO_INDEX;
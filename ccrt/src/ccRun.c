@@ -42,6 +42,7 @@
 #include "ccLog.h"
 #include "ccRun.h"
 #include "ccSim.h"
+#include "ccChan.h"
 
 
 
@@ -68,40 +69,40 @@ static void ccRunWarning(enum REG_enabled_disabled *warning, bool flag)
 
 
 
-static void ccRunFaultsAndWarnings(void)
+static void ccRunFaultsAndWarnings(struct ccchan *chan)
 {
     bool    sum_of_faults = false;
 
     // Latch active faults and accumulate the sum of faults
 
-    sum_of_faults |= ccRunFaultLatch(&ccpars_faults.b_meas_invalid,
-                        regMgrVar(REG_mgr, MEAS_B_INVALID_SEQ_COUNTER) > regMgrVar(REG_mgr, BREG_PERIOD_ITERS));
-    sum_of_faults |= ccRunFaultLatch(&ccpars_faults.i_meas_invalid,
-                        regMgrVar(REG_mgr, MEAS_I_INVALID_SEQ_COUNTER) > regMgrVar(REG_mgr, IREG_PERIOD_ITERS));
+    sum_of_faults |= ccRunFaultLatch(&chan->faults->b_meas_invalid,
+                        regMgrVarP(chan->reg_mgr, MEAS_B_INVALID_SEQ_COUNTER) > regMgrVarP(chan->reg_mgr, BREG_PERIOD_ITERS));
+    sum_of_faults |= ccRunFaultLatch(&chan->faults->i_meas_invalid,
+                        regMgrVarP(chan->reg_mgr, MEAS_I_INVALID_SEQ_COUNTER) > regMgrVarP(chan->reg_mgr, IREG_PERIOD_ITERS));
 
-    sum_of_faults |= ccRunFaultLatch(&ccpars_faults.b_meas_limit,   regMgrVar(REG_mgr, FLAG_B_MEAS_TRIP)       );
-    sum_of_faults |= ccRunFaultLatch(&ccpars_faults.b_reg_err,      regMgrVar(REG_mgr, FLAG_B_REG_ERR_FAULT)   );
-    sum_of_faults |= ccRunFaultLatch(&ccpars_faults.i_meas_limit,   regMgrVar(REG_mgr, FLAG_I_MEAS_TRIP)       );
-    sum_of_faults |= ccRunFaultLatch(&ccpars_faults.i_reg_err,      regMgrVar(REG_mgr, FLAG_I_REG_ERR_FAULT)   );
-    sum_of_faults |= ccRunFaultLatch(&ccpars_faults.v_reg_err,      regMgrVar(REG_mgr, FLAG_V_REG_ERR_FAULT)   );
-    sum_of_faults |= ccRunFaultLatch(&ccpars_faults.i_rms,          regMgrVar(REG_mgr, FLAG_I_RMS_FAULT)       );
-    sum_of_faults |= ccRunFaultLatch(&ccpars_faults.i_rms_load,     regMgrVar(REG_mgr, FLAG_I_RMS_LOAD_FAULT)  );
-    sum_of_faults |= ccRunFaultLatch(&ccpars_faults.polswitch,      ccpars_state.polswitch == POLSWITCH_FAULT);
+    sum_of_faults |= ccRunFaultLatch(&chan->faults->b_meas_limit,   regMgrVarP(chan->reg_mgr, FLAG_B_MEAS_TRIP)       );
+    sum_of_faults |= ccRunFaultLatch(&chan->faults->b_reg_err,      regMgrVarP(chan->reg_mgr, FLAG_B_REG_ERR_FAULT)   );
+    sum_of_faults |= ccRunFaultLatch(&chan->faults->i_meas_limit,   regMgrVarP(chan->reg_mgr, FLAG_I_MEAS_TRIP)       );
+    sum_of_faults |= ccRunFaultLatch(&chan->faults->i_reg_err,      regMgrVarP(chan->reg_mgr, FLAG_I_REG_ERR_FAULT)   );
+    sum_of_faults |= ccRunFaultLatch(&chan->faults->v_reg_err,      regMgrVarP(chan->reg_mgr, FLAG_V_REG_ERR_FAULT)   );
+    sum_of_faults |= ccRunFaultLatch(&chan->faults->i_rms,          regMgrVarP(chan->reg_mgr, FLAG_I_RMS_FAULT)       );
+    sum_of_faults |= ccRunFaultLatch(&chan->faults->i_rms_load,     regMgrVarP(chan->reg_mgr, FLAG_I_RMS_LOAD_FAULT)  );
+    sum_of_faults |= ccRunFaultLatch(&chan->faults->polswitch,      chan->state->polswitch == POLSWITCH_FAULT);
 
-    ccrun.fault = sum_of_faults;
+    chan->run->fault = sum_of_faults;
 
     // Set warnings parameters
 
-    ccRunWarning(&ccpars_warnings.b_reg_err,  regMgrVar(REG_mgr, FLAG_B_REG_ERR_WARNING) );
-    ccRunWarning(&ccpars_warnings.i_reg_err,  regMgrVar(REG_mgr, FLAG_I_REG_ERR_WARNING) );
-    ccRunWarning(&ccpars_warnings.v_reg_err,  regMgrVar(REG_mgr, FLAG_V_REG_ERR_WARNING) );
-    ccRunWarning(&ccpars_warnings.i_rms,      regMgrVar(REG_mgr, FLAG_I_RMS_WARNING)     );
-    ccRunWarning(&ccpars_warnings.i_rms_load, regMgrVar(REG_mgr, FLAG_I_RMS_LOAD_WARNING));
+    ccRunWarning(&chan->warnings->b_reg_err,  regMgrVarP(chan->reg_mgr, FLAG_B_REG_ERR_WARNING) );
+    ccRunWarning(&chan->warnings->i_reg_err,  regMgrVarP(chan->reg_mgr, FLAG_I_REG_ERR_WARNING) );
+    ccRunWarning(&chan->warnings->v_reg_err,  regMgrVarP(chan->reg_mgr, FLAG_V_REG_ERR_WARNING) );
+    ccRunWarning(&chan->warnings->i_rms,      regMgrVarP(chan->reg_mgr, FLAG_I_RMS_WARNING)     );
+    ccRunWarning(&chan->warnings->i_rms_load, regMgrVarP(chan->reg_mgr, FLAG_I_RMS_LOAD_WARNING));
 }
 
 
 
-static uint32_t ccRunStartFunction(double iter_time, float *ref)
+static uint32_t ccRunStartFunction(struct ccchan *chan, double iter_time, float *ref)
 {
     float           delay;
     float           rate;
@@ -110,33 +111,33 @@ static uint32_t ccRunStartFunction(double iter_time, float *ref)
 
     // If a pre-function RAMP segment should be started
 
-    if(ccrun.prefunc.idx < ccrun.prefunc.num_ramps)
+    if(chan->run->prefunc.idx < chan->run->prefunc.num_ramps)
     {
         float   prefunc_final_ref = 0.0;
 
         // If first pre-function segment
 
-        if(ccrun.prefunc.idx == 0)
+        if(chan->run->prefunc.idx == 0)
         {
             // If functions are finished then program a final plateau of duration GLOBAL STOP_DELAY
 
-            if(++ccrun.cycle_idx >= num_cycles)
+            if(++chan->run->cycle_idx >= num_cycles)
             {
-                ccrun.cycle_idx = 0;
+                chan->run->cycle_idx = 0;
             }
 
             // start pre-function between two functions
 
             {
-                float invert_limits = reg_mgr.reg_signal->lim_ref.invert_limits == REG_ENABLED ? -1.0 : 1.0;
+                float invert_limits = chan->reg_mgr->reg_signal->lim_ref.invert_limits == REG_ENABLED ? -1.0 : 1.0;
 
                 // Set cyc_sel for the next cycle
 
-                ccrun.cyc_sel = ccrun.cycle[ccrun.cycle_idx].cyc_sel;
+                chan->run->cyc_sel = chan->run->cycle[chan->run->cycle_idx].cyc_sel;
 
                 // Set regulation mode for the next function
 
-                regMgrModeSetRT(&reg_mgr, ccpars_ref[ccrun.cyc_sel].reg_mode);
+                regMgrModeSetRT(chan->reg_mgr, chan->ref[chan->run->cyc_sel].reg_mode);
 
                 // Set up pre-function segment references according to the pre-function policy
 
@@ -144,31 +145,31 @@ static uint32_t ccRunStartFunction(double iter_time, float *ref)
                 {
                     case PREFUNC_RAMP:
 
-                        ccrun.prefunc.num_ramps    = 1;
-                        prefunc_final_ref          = ccpars_ref[ccrun.cyc_sel].fg_meta.range.initial_ref;
+                        chan->run->prefunc.num_ramps    = 1;
+                        prefunc_final_ref               = chan->ref[chan->run->cyc_sel].fg_meta.range.initial_ref;
                         break;
 
                     case PREFUNC_UPMINMAX:
                     case PREFUNC_DOWNMAXMIN:
 
-                        ccrun.prefunc.num_ramps    = 3;
-                        prefunc_final_ref          = ccpars_prefunc.min * invert_limits;
-                        ccrun.prefunc.final_ref[1] = ccpars_prefunc.max * invert_limits;
-                        ccrun.prefunc.final_ref[2] = ccpars_ref[ccrun.cyc_sel].fg_meta.range.initial_ref;
+                        chan->run->prefunc.num_ramps    = 3;
+                        prefunc_final_ref               = ccpars_prefunc.min * invert_limits;
+                        chan->run->prefunc.final_ref[1] = ccpars_prefunc.max * invert_limits;
+                        chan->run->prefunc.final_ref[2] = chan->ref[chan->run->cyc_sel].fg_meta.range.initial_ref;
                         break;
                 }
 
                 delay = 0;
 
-                if(reg_mgr.reg_mode == REG_VOLTAGE)
+                if(chan->reg_mgr->reg_mode == REG_VOLTAGE)
                 {
-                    *ref = regRstPrevActRT (&reg_mgr.reg_signal->rst_vars);
-                    rate = regRstAverageDeltaActRT(&reg_mgr.reg_signal->rst_vars) / reg_mgr.reg_period;
+                    *ref = regRstPrevActRT (&chan->reg_mgr->reg_signal->rst_vars);
+                    rate = regRstAverageDeltaActRT(&chan->reg_mgr->reg_signal->rst_vars) / chan->reg_mgr->reg_period;
                 }
                 else
                 {
-                    *ref = regRstPrevRefRT (&reg_mgr.reg_signal->rst_vars);
-                    rate = reg_mgr.reg_signal->rate.estimate;
+                    *ref = regRstPrevRefRT (&chan->reg_mgr->reg_signal->rst_vars);
+                    rate = chan->reg_mgr->reg_signal->rate.estimate;
                 }
 
                 if(prefunc_final_ref == *ref)
@@ -181,37 +182,37 @@ static uint32_t ccRunStartFunction(double iter_time, float *ref)
 
             // Prepare to generate the first pre-function RAMP segment
 
-            ccrun.fgen_func = fgRampRT;
-            ccrun.fg_func_pars = &ccrun.prefunc.pars;
+            chan->run->fgen_func = fgRampRT;
+            chan->run->fg_func_pars = &chan->run->prefunc.pars;
         }
         else // Prepare to generate the second or third pre-function RAMP segment
         {
-            prefunc_final_ref = ccrun.prefunc.final_ref[ccrun.prefunc.idx];
+            prefunc_final_ref = chan->run->prefunc.final_ref[chan->run->prefunc.idx];
             delay = ccpars_prefunc.plateau_duration;
             rate  = 0.0;
         }
 
         // Arm a RAMP for the next pre-function segment - flip reference sign when limits are inverted
 
-        fgRampCalc(ccsim.polswitch.automatic,
-                   ccsim.polswitch.negative,
+        fgRampCalc(chan->sim->polswitch.automatic,
+                   chan->sim->polswitch.negative,
                    delay,
                    rate,
                    *ref,
                    prefunc_final_ref,
-                   ccpars_default.pars[reg_mgr.reg_mode].acceleration,
-                   ccpars_default.pars[reg_mgr.reg_mode].linear_rate,
-                   ccpars_default.pars[reg_mgr.reg_mode].deceleration,
-                   &ccrun.prefunc.pars,
+                   ccpars_default.pars[chan->reg_mgr->reg_mode].acceleration,
+                   ccpars_default.pars[chan->reg_mgr->reg_mode].linear_rate,
+                   ccpars_default.pars[chan->reg_mgr->reg_mode].deceleration,
+                   &chan->run->prefunc.pars,
                    &meta);
 
-        ccrun.cycle_time_origin = iter_time + reg_mgr.ref_advance;
+        chan->run->cycle_time_origin = iter_time + chan->reg_mgr->ref_advance;
 
-        if(reg_mgr.reg_mode != REG_VOLTAGE)
+        if(chan->reg_mgr->reg_mode != REG_VOLTAGE)
         {
-            ccrun.cycle_time_origin -= reg_mgr.reg_signal->iteration_counter * reg_mgr.iter_period;
+            chan->run->cycle_time_origin -= chan->reg_mgr->reg_signal->iteration_counter * chan->reg_mgr->iter_period;
         }
-        ccrun.prefunc.idx++;
+        chan->run->prefunc.idx++;
     }
     else // Pre-function sequence complete - start the next function
     {
@@ -219,33 +220,33 @@ static uint32_t ccRunStartFunction(double iter_time, float *ref)
 
         // If all functions completed
 
-        if(ccrun.cycle_idx >= num_cycles)
+        if(chan->run->cycle_idx >= num_cycles)
         {
             return(0);      // Return 0 to end simulation
         }
 
         // Set regulation mode (which won't change) to reset max abs error values
 
-        regMgrModeSetRT(&reg_mgr, ccpars_ref[ccrun.cyc_sel].reg_mode);
+        regMgrModeSetRT(chan->reg_mgr, chan->ref[chan->run->cyc_sel].reg_mode);
 
         // Prepare to generate new function
 
-        func_idx = ccpars_ref[ccrun.cyc_sel].function;
+        func_idx = chan->ref[chan->run->cyc_sel].function;
 
-        ccrun.fgen_func = funcs[func_idx].fgen_func;
-        ccrun.fg_func_pars = funcs[func_idx].fg_pars + funcs[func_idx].size_of_pars * ccrun.cyc_sel;
+        chan->run->fgen_func = funcs[func_idx].fgen_func;
+        chan->run->fg_func_pars = chan->fg_pars[chan->run->cyc_sel];
 
-        ccrun.cycle_end_time = ccpars_global.run_delay + ccpars_ref[ccrun.cyc_sel].fg_meta.duration;
+        chan->run->cycle_end_time = ccpars_global.run_delay + chan->ref[chan->run->cyc_sel].fg_meta.duration;
 
-        ccrun.cycle_time_origin = iter_time;
+        chan->run->cycle_time_origin = iter_time;
 
-        ccrun.cycle[ccrun.cycle_idx].ref_advance = reg_mgr.ref_advance;
-        ccrun.cycle[ccrun.cycle_idx].start_time  = iter_time;
+        chan->run->cycle[chan->run->cycle_idx].ref_advance = chan->reg_mgr->ref_advance;
+        chan->run->cycle[chan->run->cycle_idx].start_time  = iter_time;
 
         // Reset pre-function index for when this new function ends
 
-        ccrun.prefunc.idx       = 0;
-        ccrun.prefunc.num_ramps = 1;
+        chan->run->prefunc.idx       = 0;
+        chan->run->prefunc.num_ramps = 1;
     }
 
     return(1); // Return 1 to continue the simulation
@@ -253,7 +254,7 @@ static uint32_t ccRunStartFunction(double iter_time, float *ref)
 
 
 
-void ccRun(union sigval sigval)
+void ccRunChannelRT(struct ccchan *chan)
 {
     uint32_t    reg_iteration_counter;
     double      ref_time;
@@ -263,19 +264,23 @@ void ccRun(union sigval sigval)
 
     // Adjust time stamp
 
-    ccrun.iter_time.tv_usec += CC_ITER_PERIOD_US;
+    chan->run->iter_time.tv_usec += CC_ITER_PERIOD_US;
 
-    if(ccrun.iter_time.tv_usec >= 1000000)
+    if(chan->run->iter_time.tv_usec >= 1000000)
     {
-        ccrun.iter_time.tv_sec++;
-        ccrun.iter_time.tv_usec -= 1000000;
+        chan->run->iter_time.tv_sec++;
+        chan->run->iter_time.tv_usec -= 1000000;
     }
 
-    ccrun.iter_time_s = (double)ccrun.iter_time.tv_sec + (double)ccrun.iter_time.tv_usec * 1.0E-6;
+    chan->run->iter_time_s = (double)chan->run->iter_time.tv_sec + (double)chan->run->iter_time.tv_usec * 1.0E-6;
+
+    // Consume the supercycle timeline events for this iteration
+
+    ccSimSuperCycleRT(chan);
 
     // Calculate reference time taking into account the ref advance for the active regulation mode
 
-    ref_time = ccrun.iter_time_s - ccrun.cycle_time_origin + regMgrVar(REG_mgr, REF_ADVANCE);
+    ref_time = chan->run->iter_time_s - chan->run->cycle_time_origin + regMgrVarP(chan->reg_mgr, REF_ADVANCE);
 
     // The "real" measurements are invalid while the simulated measurements are good so setting
     // the use_sim_meas is equivalent to indicating to libreg that the measurements are invalid on
@@ -285,56 +290,58 @@ void ccRun(union sigval sigval)
 
     // Give new measurements to libreg and receive iteration counter (it's zero on regulation iterations)
 
-    reg_iteration_counter = regMgrMeasSetRT(&reg_mgr, REG_OPERATIONAL_RST_PARS, 0, 0, use_sim_meas, false);
+    reg_iteration_counter = regMgrMeasSetRT(chan->reg_mgr, REG_OPERATIONAL_RST_PARS, 0, 0, use_sim_meas, false);
 
-    if(ccpars_state.pc == PC_ON && reg_iteration_counter == 0)
+    if(chan->state->pc == PC_ON && reg_iteration_counter == 0)
     {
-        switch(regMgrVar(REG_mgr, REG_MODE))
+        switch(regMgrVarP(chan->reg_mgr, REG_MODE))
         {
             case REG_NONE:      ref = 0;                    break;
-            case REG_VOLTAGE:   ref = ccpars_direct.v_ref;  break;
-            case REG_CURRENT:   ref = ccpars_direct.i_ref;  break;
-            case REG_FIELD:     ref = ccpars_direct.b_ref;  break;
+            case REG_VOLTAGE:   ref = chan->direct->v_ref;  break;
+            case REG_CURRENT:   ref = chan->direct->i_ref;  break;
+            case REG_FIELD:     ref = chan->direct->b_ref;  break;
         }
 
-        regMgrRegulateRT(&reg_mgr, &ref);
+        regMgrRegulateRT(chan->reg_mgr, &ref);
     }
 
     // Simulate voltage source and load response
 
-    regMgrSimulateRT(&reg_mgr, NULL, 0.0);
+    regMgrSimulateRT(chan->reg_mgr, NULL, 0.0);
 
     // Check faults and warnings
 
-    ccRunFaultsAndWarnings();
+    ccRunFaultsAndWarnings(chan);
 
     // Store field regulation signals in log at regulation rate
 
-    if(regMgrVar(REG_mgr, BREG_ITER_COUNTER) == 0)
+    if(regMgrVarP(chan->reg_mgr, BREG_ITER_COUNTER) == 0)
     {
-        ccLogStoreReg(&breg_log, ccrun.iter_time_s);
+        ccLogStoreReg(chan->breg_log, chan->run->iter_time_s);
     }
 
     // Store current regulation signals in log at regulation rate
 
-    if(regMgrVar(REG_mgr, IREG_ITER_COUNTER) == 0)
+    if(regMgrVarP(chan->reg_mgr, IREG_ITER_COUNTER) == 0)
     {
-        ccLogStoreReg(&ireg_log, ccrun.iter_time_s);
+        ccLogStoreReg(chan->ireg_log, chan->run->iter_time_s);
     }
 
     // Store measurement rate signals in log every iteration
 
-    ccLogStoreMeas(ccrun.iter_time_s);
+    ccLogStoreMeas(chan);
 
     // Simulate PC state and Polarity Switch behaviour
 
-    ccSimPcState();
-    ccSimPolSwitch();
+    ccSimPcState(chan);
+    ccSimPolSwitch(chan);
 
-    if(ccpars_state.pc == PC_ON)
+    if(chan->state->pc == PC_ON)
     {
-        regMgrModeSetRT(&reg_mgr, ccpars_ref[0].reg_mode);
+        regMgrModeSetRT(chan->reg_mgr, chan->ref[0].reg_mode);
     }
+
+    chan->run->iter_counter++;
 }
 
 
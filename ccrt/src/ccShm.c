@@ -0,0 +1,113 @@
+/*!
+ * @file  ccrt/src/ccShm.c
+ *
+ * @brief ccrt shared memory telemetry
+ *
+ * The segment is created by ccShmInit() and is then written only by the real-time threads,
+ * using ccShmStoreRT() after each channel iteration.
+ *
+ * <h2>Copyright</h2>
+ *
+ * Copyright CERN 2015. This project is released under the GNU Lesser General
+ * Public License version 3.
+ *
+ * <h2>License</h2>
+ *
+ * This file is part of ccrt.
+ *
+ * ccrt is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// Include ccrt program header files
+
+#include "ccRun.h"
+#include "ccChan.h"
+#include "ccShm.h"
+
+#if CC_MAX_CHANNELS > CC_SHM_MAX_CHANNELS
+#error CC_SHM_MAX_CHANNELS must not be less than CC_MAX_CHANNELS
+#endif
+
+
+
+// Background functions - do not call these from the real-time thread or interrupt
+
+uint32_t ccShmInit(char const *name, uint32_t num_channels)
+{
+    struct ccshm_segment *segment;
+    int                   fd;
+
+    fd = shm_open(name, O_CREAT | O_RDWR, 0644);
+
+    if(fd < 0)
+    {
+        printf("Error - failed to open shared memory segment %s : %s\n", name, strerror(errno));
+        return(EXIT_FAILURE);
+    }
+
+    if(ftruncate(fd, sizeof(struct ccshm_segment)) != 0)
+    {
+        printf("Error - failed to size shared memory segment %s : %s\n", name, strerror(errno));
+        close(fd);
+        return(EXIT_FAILURE);
+    }
+
+    segment = mmap(NULL, sizeof(struct ccshm_segment), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+    close(fd);
+
+    if(segment == MAP_FAILED)
+    {
+        printf("Error - failed to map shared memory segment %s : %s\n", name, strerror(errno));
+        return(EXIT_FAILURE);
+    }
+
+    // Clear the segment left by a previous run and set the magic number last so that readers
+    // can tell when the header is valid
+
+    memset(segment, 0, sizeof(struct ccshm_segment));
+
+    segment->version      = CC_SHM_VERSION;
+    segment->num_channels = num_channels;
+    segment->num_vars     = REG_NUM_VARS;
+    segment->vars_size    = sizeof(struct ccshm_vars);
+
+    atomic_thread_fence(memory_order_release);
+
+    segment->magic = CC_SHM_MAGIC;
+
+    ccshm = segment;
+
+    return(EXIT_SUCCESS);
+}
+
+
+
+// Real-Time Functions
+
+void ccShmStoreRT(struct ccchan *chan)
+{
+    ccShmWriteRT(&ccshm->chan[chan->idx], chan->reg_mgr, chan->run->iter_counter, chan->run->iter_time_s);
+}
+
+// EOF
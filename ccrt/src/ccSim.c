@@ -46,29 +46,37 @@
 #include "ccLog.h"
 #include "ccRun.h"
 #include "ccSim.h"
+#include "ccChan.h"
+#include "ccTimeline.h"
 
+// The timeline must have room for one event per cycle of the supercycle
 
+#if MAX_CYCLES > CC_TIMELINE_MAX_EVENTS
+#error CC_TIMELINE_MAX_EVENTS must not be less than MAX_CYCLES
+#endif
 
-void ccSimPcState(void)
+
+
+void ccSimPcState(struct ccchan *chan)
 {
     // If any fault is active then immediately switch to FAULT state
 
-    if(ccrun.fault)
+    if(chan->run->fault)
     {
-        ccpars_state.pc = PC_FAULT;
+        chan->state->pc = PC_FAULT;
     }
     else
     {
         // Delay switching on but not switching off
 
-        if(ccpars_pc.state != ccpars_state.pc)
+        if(ccpars_pc.state != chan->state->pc)
         {
-            ccsim.pcstate.timer += regMgrVar(REG_mgr,ITER_PERIOD);
+            chan->sim->pcstate.timer += regMgrVarP(chan->reg_mgr, ITER_PERIOD);
 
-            if(ccpars_pc.state == PC_OFF || ccsim.pcstate.timer > 1.5)
+            if(ccpars_pc.state == PC_OFF || chan->sim->pcstate.timer > 1.5)
             {
-                ccpars_state.pc = ccpars_pc.state;
-                ccsim.pcstate.timer = 0.0;
+                chan->state->pc = ccpars_pc.state;
+                chan->sim->pcstate.timer = 0.0;
             }
         }
     }
@@ -76,17 +84,17 @@ void ccSimPcState(void)
 
 
 
-void ccSimPolSwitch(void)
+void ccSimPolSwitch(struct ccchan *chan)
 {
     // Run PolSwitch state machine
 
-    switch(ccpars_state.polswitch)
+    switch(chan->state->polswitch)
     {
         case POLSWITCH_NONE:
 
-            ccsim.polswitch.timer = 0.0;
+            chan->sim->polswitch.timer = 0.0;
 
-            if(regMgrVar(REG_mgr,REG_MODE) == REG_NONE &&
+            if(regMgrVarP(chan->reg_mgr, REG_MODE) == REG_NONE &&
                ccpars_polswitch.timeout > 0.0)
             {
                 switch(ccpars_polswitch.command)
@@ -94,12 +102,12 @@ void ccSimPolSwitch(void)
                     case POLSWITCH_CMD_AUTOMATIC:
                     case POLSWITCH_CMD_POSITIVE:
 
-                        ccpars_state.polswitch = ccsim.polswitch.target_state = POLSWITCH_POSITIVE;
+                        chan->state->polswitch = chan->sim->polswitch.target_state = POLSWITCH_POSITIVE;
                         break;
 
                     case POLSWITCH_CMD_NEGATIVE:
 
-                        ccpars_state.polswitch = ccsim.polswitch.target_state = POLSWITCH_NEGATIVE;
+                        chan->state->polswitch = chan->sim->polswitch.target_state = POLSWITCH_NEGATIVE;
                         break;
                 }
             }
@@ -109,13 +117,13 @@ void ccSimPolSwitch(void)
 
             if(ccpars_polswitch.timeout <= 0.0)
             {
-                ccpars_state.polswitch = POLSWITCH_NONE;
+                chan->state->polswitch = POLSWITCH_NONE;
             }
-            else if(regMgrVar(REG_mgr,REG_MODE) == REG_NONE &&
-              (ccpars_polswitch.command == POLSWITCH_CMD_NEGATIVE || ccsim.polswitch.target_state == POLSWITCH_NEGATIVE))
+            else if(regMgrVarP(chan->reg_mgr, REG_MODE) == REG_NONE &&
+              (ccpars_polswitch.command == POLSWITCH_CMD_NEGATIVE || chan->sim->polswitch.target_state == POLSWITCH_NEGATIVE))
             {
-                ccsim.polswitch.target_state = POLSWITCH_NEGATIVE;
-                ccpars_state.polswitch  = POLSWITCH_MOVING;
+                chan->sim->polswitch.target_state = POLSWITCH_NEGATIVE;
+                chan->state->polswitch  = POLSWITCH_MOVING;
             }
             break;
 
@@ -123,30 +131,30 @@ void ccSimPolSwitch(void)
 
             if(ccpars_polswitch.timeout <= 0.0)
             {
-                ccpars_state.polswitch = POLSWITCH_NONE;
+                chan->state->polswitch = POLSWITCH_NONE;
             }
-            else if(regMgrVar(REG_mgr,REG_MODE) == REG_NONE &&
-              (ccpars_polswitch.command == POLSWITCH_CMD_POSITIVE || ccsim.polswitch.target_state == POLSWITCH_POSITIVE))
+            else if(regMgrVarP(chan->reg_mgr, REG_MODE) == REG_NONE &&
+              (ccpars_polswitch.command == POLSWITCH_CMD_POSITIVE || chan->sim->polswitch.target_state == POLSWITCH_POSITIVE))
             {
-                ccsim.polswitch.target_state = POLSWITCH_POSITIVE;
-                ccpars_state.polswitch  = POLSWITCH_MOVING;
+                chan->sim->polswitch.target_state = POLSWITCH_POSITIVE;
+                chan->state->polswitch  = POLSWITCH_MOVING;
             }
             break;
 
         case POLSWITCH_MOVING:
 
-            ccsim.polswitch.timer += regMgrVar(REG_mgr,ITER_PERIOD);
+            chan->sim->polswitch.timer += regMgrVarP(chan->reg_mgr, ITER_PERIOD);
 
-            if(ccsim.polswitch.timer > ccpars_polswitch.timeout)
+            if(chan->sim->polswitch.timer > ccpars_polswitch.timeout)
             {
-                ccsim.polswitch.timer   = 0.0;
-                ccpars_state.polswitch  = POLSWITCH_FAULT;
+                chan->sim->polswitch.timer   = 0.0;
+                chan->state->polswitch  = POLSWITCH_FAULT;
             }
 
-            if(ccsim.polswitch.timer > ccpars_polswitch.sim_delay)
+            if(chan->sim->polswitch.timer > ccpars_polswitch.sim_delay)
             {
-                ccpars_state.polswitch = ccsim.polswitch.target_state;
-                ccsim.polswitch.timer  = 0.0;
+                chan->state->polswitch = chan->sim->polswitch.target_state;
+                chan->sim->polswitch.timer  = 0.0;
             }
             break;
 
@@ -154,89 +162,53 @@ void ccSimPolSwitch(void)
 
             // Simulate pol switch fault being active for 5s to make it visible when the converter is off
 
-            ccsim.polswitch.timer += regMgrVar(REG_mgr,ITER_PERIOD);
+            chan->sim->polswitch.timer += regMgrVarP(chan->reg_mgr, ITER_PERIOD);
 
-            if(ccsim.polswitch.timer > 5.0)
+            if(chan->sim->polswitch.timer > 5.0)
             {
-                ccpars_state.polswitch = POLSWITCH_NONE;
+                chan->state->polswitch = POLSWITCH_NONE;
             }
             break;
     }
 
     // Set flags
 
-    ccsim.polswitch.enabled = (ccpars_state.polswitch != POLSWITCH_NONE);
+    chan->sim->polswitch.enabled = (chan->state->polswitch != POLSWITCH_NONE);
 
-    ccsim.polswitch.automatic = ccsim.polswitch.enabled && ccpars_polswitch.command == POLSWITCH_CMD_AUTOMATIC;
+    chan->sim->polswitch.automatic = chan->sim->polswitch.enabled && ccpars_polswitch.command == POLSWITCH_CMD_AUTOMATIC;
 
-    ccsim.polswitch.negative  = ccpars_state.polswitch == POLSWITCH_NEGATIVE;
+    chan->sim->polswitch.negative  = chan->state->polswitch == POLSWITCH_NEGATIVE;
 
-    ccsim.polswitch.limits_invert = ccsim.polswitch.negative ? REG_ENABLED : REG_DISABLED;
+    chan->sim->polswitch.limits_invert = chan->sim->polswitch.negative ? REG_ENABLED : REG_DISABLED;
 }
 
 
 
-void ccSimSuperCycle(union sigval sigval)
+void ccSimSuperCycleInit(struct ccchan *chan)
 {
-    uint32_t cyc_sel     = ccrun.supercycle.cyc_sel;
-    uint32_t ref_cyc_sel = ccrun.supercycle.ref_cyc_sel;
-    uint32_t cyc_len     = ccrun.supercycle.seconds_remaining;
-    uint32_t cyc_idx     = ccrun.supercycle.cyc_idx;
-    uint32_t num_cycles  = global_pars[GLOBAL_CYCLE_SELECTOR].num_elements[0];
-
-    if(cyc_len == 0)
+    struct cctimeline_pars pars =
     {
-        uint32_t cycle_selector;    // CCLL where CC=cyc_sel  LL=duration in seconds
-
-        if(++cyc_idx >= num_cycles)
-        {
-            cyc_idx = 0;
-        }
-
-        cycle_selector = ccpars_global.cycle_selector[cyc_idx];
-
-        if(cycle_selector == 0)
-        {
-            cyc_idx = 0;
-            cycle_selector = ccpars_global.cycle_selector[cyc_idx];
-        }
-
-        cyc_sel = cycle_selector / 100;
-        cyc_len = cycle_selector % 100;
-
-        if(cyc_len == 0)
-        {
-            cyc_len = 1;
-        }
-    }
-
-    ref_cyc_sel = cyc_sel;
-
-    if(cyc_sel > 0 && cyc_sel == ccpars_global.test_cyc_sel && ccpars_global.test_ref_cyc_sel > 0)
-    {
-        ref_cyc_sel = ccpars_global.test_ref_cyc_sel;
-    }
-
-    // Assume that basic period is 1s
-
-    ccrun.supercycle.seconds_remaining = --cyc_len;
+        .cycle_selector   = ccpars_global.cycle_selector,
+        .num_cycles       = global_pars[GLOBAL_CYCLE_SELECTOR].num_elements,
+        .test_cyc_sel     = &ccpars_global.test_cyc_sel,
+        .test_ref_cyc_sel = &ccpars_global.test_ref_cyc_sel,
+        .iters_per_second = CC_ITERS_PER_SECOND,
+    };
+
+    ccTimelineInit(&chan->run->supercycle, &pars, chan->run->iter_counter);
+}
 
-    // Update supercycle information using mutex protection
 
-    pthread_mutex_lock(&ccrun.supercycle.mutex);
 
-    ccrun.supercycle.cyc_idx     = cyc_idx;
-    ccrun.supercycle.cyc_sel     = cyc_sel;
-    ccrun.supercycle.ref_cyc_sel = ref_cyc_sel;
+void ccSimSuperCycleRT(struct ccchan *chan)
+{
+    // Consume the start-of-cycle event if one is due on this iteration
 
-    pthread_mutex_unlock(&ccrun.supercycle.mutex);
+    ccTimelineRT(&chan->run->supercycle, chan->run->iter_counter);
 
-    // On last second of the cycle, notify about the next cycle
+    chan->run->time_till_event_us = (int32_t)(chan->run->supercycle.next_event_iter - chan->run->iter_counter) * CC_ITER_PERIOD_US;
 
-    if(ccrun.supercycle.seconds_remaining == 0)
-    {
     // Call libref function to declare next event - when in CYCLING or TO_CYCLING states
-    }
 }
 
 // EOF
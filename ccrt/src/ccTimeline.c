@@ -0,0 +1,154 @@
+/*!
+ * @file  ccrt/src/ccTimeline.c
+ *
+ * @brief ccrt supercycle timeline functions
+ *
+ * <h2>Copyright</h2>
+ *
+ * Copyright CERN 2015. This project is released under the GNU Lesser General
+ * Public License version 3.
+ *
+ * <h2>License</h2>
+ *
+ * This file is part of ccrt.
+ *
+ * ccrt is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+// Include ccrt program header files
+
+#include "ccTimeline.h"
+
+
+
+static void ccTimelineBuild(struct cctimeline *timeline)
+{
+    uint32_t cyc_idx;
+    uint32_t cyc_len;
+    uint32_t cycle_selector;    // CCLL where CC=cyc_sel  LL=duration in seconds
+    uint32_t start_iters = 0;
+    uint32_t num_cycles  = *timeline->pars.num_cycles;
+    struct cctimeline_event *event = timeline->event;
+
+    if(num_cycles > CC_TIMELINE_MAX_EVENTS)
+    {
+        num_cycles = CC_TIMELINE_MAX_EVENTS;
+    }
+
+    // Compile the cycle selectors into a sorted array of start-of-cycle events - a zero cycle selector
+    // ends the supercycle, and an empty supercycle is a single one second cycle for cycle selector 0
+
+    for(cyc_idx = 0 ; cyc_idx == 0 || cyc_idx < num_cycles ; cyc_idx++, event++)
+    {
+        cycle_selector = cyc_idx < num_cycles ? timeline->pars.cycle_selector[cyc_idx] : 0;
+
+        if(cyc_idx > 0 && cycle_selector == 0)
+        {
+            break;
+        }
+
+        cyc_len = cycle_selector % 100;
+
+        if(cyc_len == 0)
+        {
+            cyc_len = 1;
+        }
+
+        event->start_iters = start_iters;
+        event->cyc_idx     = cyc_idx;
+        event->cyc_sel     = cycle_selector / 100;
+        event->ref_cyc_sel = event->cyc_sel;
+
+        if(event->cyc_sel > 0 && event->cyc_sel == *timeline->pars.test_cyc_sel && *timeline->pars.test_ref_cyc_sel > 0)
+        {
+            event->ref_cyc_sel = *timeline->pars.test_ref_cyc_sel;
+        }
+
+        // Assume that basic period is 1s
+
+        start_iters += cyc_len * timeline->pars.iters_per_second;
+    }
+
+    timeline->num_events   = cyc_idx;
+    timeline->length_iters = start_iters;
+}
+
+
+
+void ccTimelineInit(struct cctimeline *timeline, struct cctimeline_pars const *pars, uint64_t iter_counter)
+{
+    // The first event of the supercycle will be consumed by the next call to ccTimelineRT()
+
+    timeline->pars            = *pars;
+    timeline->event_idx       = 0;
+    timeline->start_iter      = iter_counter;
+    timeline->next_event_iter = iter_counter;
+
+    ccTimelineBuild(timeline);
+}
+
+
+
+bool ccTimelineRT(struct cctimeline *timeline, uint64_t iter_counter)
+{
+    struct cctimeline_event *event;
+
+    // The common path is a single comparison
+
+    if(iter_counter != timeline->next_event_iter)
+    {
+        return(false);
+    }
+
+    // Rebuild the timeline at the start of each supercycle so changes to the cycle selectors take effect
+
+    if(timeline->event_idx == 0)
+    {
+        timeline->start_iter = iter_counter;
+
+        ccTimelineBuild(timeline);
+    }
+
+    event = &timeline->event[timeline->event_idx];
+
+    // Update supercycle information using mutex protection
+
+    pthread_mutex_lock(&timeline->mutex);
+
+    timeline->cyc_idx     = event->cyc_idx;
+    timeline->cyc_sel     = event->cyc_sel;
+    timeline->ref_cyc_sel = event->ref_cyc_sel;
+
+    pthread_mutex_unlock(&timeline->mutex);
+
+    // Schedule the next event, which is the start of the next supercycle after the last event
+
+    if(++timeline->event_idx >= timeline->num_events)
+    {
+        timeline->event_idx       = 0;
+        timeline->next_event_iter = timeline->start_iter + timeline->length_iters;
+    }
+    else
+    {
+        timeline->next_event_iter = timeline->start_iter + timeline->event[timeline->event_idx].start_iters;
+    }
+
+    return(true);
+}
+
+// EOF
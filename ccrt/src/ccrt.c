@@ -58,106 +58,99 @@
 #include "ccRef.h"
 #include "ccLog.h"
 #include "ccFlot.h"
-
-// Constants
-
-#define TIMER_PRIORITY  0        // 0 for non-realtime Linux kernel
+#include "ccChan.h"
+#include "ccShm.h"
 
 // Static variables
 
 static char             cwd_buf[CC_PATH_LEN];
 
-struct cc_thread
-{
-    pthread_attr_t          thread_attr;    // Thread attricute
-    struct sched_param      thread_param;   // Thread scheduling parameters
-    struct itimerspec       timer_spec;     // Timer specification
-    timer_t                 timer_id;       // ID of new timer
-    struct sigevent         event;          // Event configuration
-};
-
-static struct cc_thread      rt_thread;
-static struct cc_thread      sc_thread;
 
 
-
-static void StartRtThread(uint32_t rt_period_s, uint32_t rt_period_ns, struct cc_thread *cc_thread, void (*function)(union sigval))
+static void AtExit(void)
 {
-    // Configure thread attributes
-
-    if(pthread_attr_init(&cc_thread->thread_attr) == -1)
-    {
-        printf("Error - pthread_attr_init\n");
-        exit(EXIT_FAILURE);
-    }
-
-#if TIMER_PRIORITY == 0
-    pthread_attr_setinheritsched(&cc_thread->thread_attr, PTHREAD_INHERIT_SCHED);
-
-    sched_getparam(getpid(), &cc_thread->thread_param);
-    pthread_attr_setschedparam(&cc_thread->thread_attr, &cc_thread->thread_param);
-#else
-    pthread_attr_setinheritsched(&cc_thread->thread_attr, PTHREAD_EXPLICIT_SCHED);
-    pthread_attr_setschedpolicy( &cc_thread->thread_attr, SCHED_FIFO);
-
-    sched_getparam(getpid(), &cc_thread->thread_param);
-    cc_thread->thread_param.sched_priority = TIMER_PRIORITY;
-    pthread_attr_setschedparam(&cc_thread->thread_attr, &cc_thread->thread_param);
-#endif
-
-    // Configure event handler
+    // Restore current working directory from when the program started
 
-    cc_thread->event.sigev_notify              = SIGEV_THREAD;
-    cc_thread->event.sigev_notify_attributes   = &cc_thread->thread_attr;
-    cc_thread->event.sigev_notify_function     = function;
+    chdir(cwd_buf);
+}
 
-    // Create timer
 
-    if(timer_create(CLOCK_REALTIME, &cc_thread->event, &cc_thread->timer_id))
-    {
-        printf("Error - timer_create : %s (%d)\n", strerror(errno), errno);
-        exit(EXIT_FAILURE);
-    }
 
-    // Configure timer specification
+static bool ParseCount(char const *arg, uint32_t max_value, uint32_t *value)
+{
+    char          *end;
+    unsigned long  count;
 
-    cc_thread->timer_spec.it_value.tv_sec     = 1;
-    cc_thread->timer_spec.it_value.tv_nsec    = rt_period_ns;
-    cc_thread->timer_spec.it_interval.tv_sec  = rt_period_s;
-    cc_thread->timer_spec.it_interval.tv_nsec = rt_period_ns;
+    // Accept only a plain decimal number from 1 to max_value - strtoul() would silently accept "-1" or "4x"
 
-    // Start the timer
+    errno = 0;
+    count = strtoul(arg, &end, 10);
 
-    if(timer_settime(cc_thread->timer_id, 0, &cc_thread->timer_spec, NULL))
+    if(errno != 0 || *arg < '0' || *arg > '9' || *end != '\0' || count < 1 || count > max_value)
     {
-        printf("Error - timer_settime : %s (%d)\n", strerror(errno), errno);
-        exit(EXIT_FAILURE);
+        return(false);
     }
-}
-
 
+    *value = (uint32_t)count;
 
-static void AtExit(void)
-{
-    // Restore current working directory from when the program started
-
-    chdir(cwd_buf);
+    return(true);
 }
 
 
 
 int main(int argc, char **argv)
 {
+    char    *program = argv[0];
     uint32_t rt_period_ns = CC_ITER_PERIOD_US * 1000;     // 1ms by default
+    uint32_t num_channels = 1;
+    uint32_t num_threads  = 1;
     char     line[CC_PATH_LEN];
     char    *script_file = "";
     char    *default_converter = "default";
+    char    *shm_name = NULL;
+    int      option;
+
+    // Usage: ccrt [-c num_channels] [-t num_rt_threads] [-f] [-m shm_name] [converter_name [script]]
+
+    while((option = getopt(argc, argv, "c:t:fm:")) != -1)
+    {
+        switch(option)
+        {
+            case 'c':
+
+                if(!ParseCount(optarg, CC_MAX_CHANNELS, &num_channels))
+                {
+                    printf("Error - number of channels (%s) must be 1-%u\n", optarg, CC_MAX_CHANNELS);
+                    exit(EXIT_FAILURE);
+                }
+                break;
+
+            case 't':
+
+                if(!ParseCount(optarg, CC_MAX_RT_THREADS, &num_threads))
+                {
+                    printf("Error - number of real-time threads (%s) must be 1-%u\n", optarg, CC_MAX_RT_THREADS);
+                    exit(EXIT_FAILURE);
+                }
+                break;
+
+            case 'f': ccchan.is_free_running = true;            break;
+            case 'm': shm_name = optarg;                        break;
+            default:
+
+                printf("usage: %s [-c num_channels] [-t num_rt_threads] [-f] [-m shm_name] [converter_name [command]]\n", program);
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    // Skip the options so that argv[1] is the converter name - argv[0] is no longer the program name
 
-    // Usage: ccrt [converter_name [script]]
+    argc -= optind - 1;
+    argv += optind - 1;
 
     if(argc > 3)
     {
-        printf("usage: %s [converter_name [command]]\n", argv[0]);
+        printf("usage: %s [-c num_channels] [-t num_rt_threads] [-f] [-m shm_name] [converter_name [command]]\n", program);
         exit(EXIT_FAILURE);
     }
     else if(argc == 1)
@@ -172,6 +165,11 @@ int main(int argc, char **argv)
         {
             rt_period_ns /= CC_OFFLINE_ACCELERATION;     // Run faster than real-time when processing a script file
             script_file = argv[2];
+
+            // Gate the real-time threads so that WAIT commands are resolved against simulated
+            // time - with -f the threads then run as fast as possible between commands
+
+            ccchan.is_gated = true;
         }
     }
 
@@ -193,7 +191,7 @@ int main(int argc, char **argv)
 
     // Try to set path to ccrt/converters/{converter}
 
-    if(ccFileCwd(dirname(argv[0]))   == EXIT_FAILURE ||
+    if(ccFileCwd(dirname(program))   == EXIT_FAILURE ||
        ccFileCwd("../../converters") == EXIT_FAILURE)
     {
         exit(EXIT_FAILURE);
@@ -257,23 +255,36 @@ int main(int argc, char **argv)
 
     ccrun.iter_time.tv_usec = 0;
 
-    // Create real-time thread for simulation, running on a timer with specified period
+    // Initialise simulation
 
-    puts("Starting real-time thread");
+    puts("Starting simulation");
 
-    StartRtThread(0, rt_period_ns, &rt_thread, ccRun);
+    regMgrSimInit(&reg_mgr, REG_NONE, 0.0);
 
-    // Create real-time thread for simulation, running on a timer with specified period
+    // Create the channels as copies of channel 0 and prepare the supercycle timeline for each channel
 
-    puts("Starting supercycle thread");
+    if(ccChanInit(num_channels, num_threads) == EXIT_FAILURE)
+    {
+        exit(EXIT_FAILURE);
+    }
 
-    StartRtThread(1, 0, &sc_thread, ccSimSuperCycle);
+    // Create the shared memory segment for live monitoring if requested
 
-    // Initialise simulation
+    if(shm_name != NULL && ccShmInit(shm_name, num_channels) == EXIT_FAILURE)
+    {
+        exit(EXIT_FAILURE);
+    }
 
-    puts("Starting simulation");
+    // Create real-time threads for the simulation, running with the specified period
 
-    regMgrSimInit(&reg_mgr, REG_NONE, 0.0);
+    printf("Starting %u real-time thread%s for %u channel%s\n",
+            num_threads,  num_threads  == 1 ? "" : "s",
+            num_channels, num_channels == 1 ? "" : "s");
+
+    if(ccChanStartThreads(rt_period_ns) == EXIT_FAILURE)
+    {
+        exit(EXIT_FAILURE);
+    }
 
     // Read from stdin or from the named script
 
@@ -0,0 +1,453 @@
+/*!
+ * @file  ccrt/test/ccTest.c
+ *
+ * @brief ccrt test program for the functions that can be built on their own
+ *
+ * <h2>Copyright</h2>
+ *
+ * Copyright CERN 2015. This project is released under the GNU Lesser General
+ * Public License version 3.
+ *
+ * <h2>License</h2>
+ *
+ * This file is part of ccrt.
+ *
+ * ccrt is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Include ccrt program header files
+
+#include "ccTimeline.h"
+#include "ccGate.h"
+#include "ccShm.h"
+
+// Constants
+
+#define CC_TEST_MAX_REPORTED_ERRORS     5                   // Number of errors printed by each check function
+#define CC_TEST_ITERS_PER_SECOND        1000                // Iterations per second for the timeline checks
+#define CC_TEST_GATE_NUM_THREADS        3                   // Number of threads for the gate check
+#define CC_TEST_SHM_NUM_READERS         2                   // Number of reader threads for the shared memory check
+#define CC_TEST_SHM_NUM_WRITES          2000000             // Number of snapshots written for the shared memory check
+
+// Table of checks
+
+struct cctest
+{
+    char                *name;
+    uint32_t           (*check)(void);
+};
+
+
+
+// Progress of the timeline checks
+
+struct cctest_timeline
+{
+    uint64_t            iter_counter;                       // Iteration counter passed to ccTimelineRT()
+    uint64_t            expected_iter;                      // Iteration of the next expected event
+    uint32_t            cyc_idx;                            // Index of the next expected cycle
+};
+
+
+
+static uint32_t ccTestTimelineRun(struct cctimeline *timeline, struct cctest_timeline *progress, uint32_t num_events,
+                                  uint32_t num_cycles, uint32_t const *cyc_len, uint32_t const *cyc_sel, uint32_t const *ref_cyc_sel)
+{
+    uint32_t num_errors = 0;
+    bool     is_event;
+
+    // Run until num_events have arrived and check that each arrives on the expected iteration with the expected cycle
+
+    while(num_events > 0)
+    {
+        is_event = ccTimelineRT(timeline, progress->iter_counter);
+
+        if(is_event != (progress->iter_counter == progress->expected_iter))
+        {
+            if(num_errors++ < CC_TEST_MAX_REPORTED_ERRORS)
+            {
+                printf("Error - ccTestTimeline: %s event at iteration %lu\n",
+                       is_event ? "unexpected" : "missing", (unsigned long)progress->iter_counter);
+            }
+        }
+
+        if(is_event)
+        {
+            uint32_t cyc_idx = progress->cyc_idx;
+
+            if(timeline->cyc_idx != cyc_idx || timeline->cyc_sel != cyc_sel[cyc_idx] || timeline->ref_cyc_sel != ref_cyc_sel[cyc_idx])
+            {
+                if(num_errors++ < CC_TEST_MAX_REPORTED_ERRORS)
+                {
+                    printf("Error - ccTestTimeline: event at iteration %lu is cycle %u (%u/%u) instead of cycle %u (%u/%u)\n",
+                           (unsigned long)progress->iter_counter, timeline->cyc_idx, timeline->cyc_sel, timeline->ref_cyc_sel,
+                           cyc_idx, cyc_sel[cyc_idx], ref_cyc_sel[cyc_idx]);
+                }
+            }
+
+            progress->expected_iter += cyc_len[cyc_idx] * CC_TEST_ITERS_PER_SECOND;
+            progress->cyc_idx        = (cyc_idx + 1) % num_cycles;
+            num_events--;
+        }
+
+        if(timeline->next_event_iter != progress->expected_iter)
+        {
+            if(num_errors++ < CC_TEST_MAX_REPORTED_ERRORS)
+            {
+                printf("Error - ccTestTimeline: next event at iteration %lu instead of %lu\n",
+                       (unsigned long)timeline->next_event_iter, (unsigned long)progress->expected_iter);
+            }
+        }
+
+        progress->iter_counter++;
+    }
+
+    return(num_errors);
+}
+
+
+
+static uint32_t ccTestTimeline(void)
+{
+    static struct cctimeline timeline = { .mutex = PTHREAD_MUTEX_INITIALIZER };
+    static uint32_t const    cycle_selector[]  = { 101, 1203, 310, 1599, 0, 777 };
+    static uint32_t const    cyc_len[]         = { 1, 3, 10, 99 };
+    static uint32_t const    cyc_sel[]         = { 1, 12, 3, 15 };
+    static uint32_t const    ref_cyc_sel[]     = { 1, 12, 5, 15 };
+    static uint32_t const    new_cyc_len[]     = { 2, 1 };
+    static uint32_t const    new_cyc_sel[]     = { 3, 4 };
+    static uint32_t const    new_ref_cyc_sel[] = { 5, 4 };
+    static uint32_t const    zero[]            = { 0 };
+    uint32_t                 cycle_selectors[CC_TIMELINE_MAX_EVENTS];
+    uint32_t                 num_cycles        = 6;
+    uint32_t                 test_cyc_sel      = 3;
+    uint32_t                 test_ref_cyc_sel  = 5;
+    uint32_t                 num_errors        = 0;
+    struct cctimeline_pars   pars              = { cycle_selectors, &num_cycles, &test_cyc_sel, &test_ref_cyc_sel, CC_TEST_ITERS_PER_SECOND };
+    struct cctest_timeline   progress          = { 12345, 12345, 0 };
+
+    // The zero cycle selector ends the supercycle after four cycles, and cycle selector 3 plays the reference of 5.
+    // Run 20 supercycles and the first cycle of the next one.
+
+    memcpy(cycle_selectors, cycle_selector, sizeof(cycle_selector));
+
+    ccTimelineInit(&timeline, &pars, progress.iter_counter);
+
+    num_errors += ccTestTimelineRun(&timeline, &progress, 81, 4, cyc_len, cyc_sel, ref_cyc_sel);
+
+    // A change to the cycle selectors must only take effect at the start of the next supercycle
+
+    cycle_selectors[0] = 302;
+    cycle_selectors[1] = 400;
+    num_cycles         = 2;
+
+    num_errors += ccTestTimelineRun(&timeline, &progress, 3, 4, cyc_len, cyc_sel, ref_cyc_sel);
+
+    progress.cyc_idx = 0;
+
+    num_errors += ccTestTimelineRun(&timeline, &progress, 40, 2, new_cyc_len, new_cyc_sel, new_ref_cyc_sel);
+
+    // An empty supercycle is a single one second cycle for cycle selector 0
+
+    num_cycles = 0;
+
+    num_errors += ccTestTimelineRun(&timeline, &progress, 5, 1, cyc_len, zero, zero);
+
+    return(num_errors);
+}
+
+
+
+// Gate used by ccTestGate() and its threads
+
+static struct ccgate        cctest_gate = { .mutex = PTHREAD_MUTEX_INITIALIZER, .cond = PTHREAD_COND_INITIALIZER };
+static _Atomic uint64_t     cctest_gate_work[CC_TEST_GATE_NUM_THREADS];
+
+
+
+static void * ccTestGateThread(void *arg)
+{
+    uint32_t thread_idx = (uint32_t)(uintptr_t)arg;
+
+    // Run iterations as fast as possible, like a free-running gated real-time thread
+
+    for(;;)
+    {
+        ccGateRT(&cctest_gate, thread_idx);
+
+        atomic_fetch_add(&cctest_gate_work[thread_idx], 1);
+
+        ccGateIterDoneRT(&cctest_gate, thread_idx);
+    }
+
+    return(NULL);
+}
+
+
+
+static uint32_t ccTestGate(void)
+{
+    static struct cctest_wait
+    {
+        double          wait_s;
+        uint64_t        num_iters;
+    } const waits[] =
+    {
+        {  0.00049,     0 },
+        {  0.00051,     1 },
+        {  0.001,       1 },
+        {  0.0014,      1 },
+        {  0.0016,      2 },
+        {  0.003,       3 },            // (useconds_t)(0.003 * 1000000) is 2999 us, which gave 2 iterations
+        {  0.0299999,  30 },
+        {  0.057,      57 },
+        {  1.0,      1000 },
+        { 12.345,   12345 },
+    };
+    pthread_t thread[CC_TEST_GATE_NUM_THREADS];
+    uint64_t  total_iters = 0;
+    uint64_t  work;
+    uint32_t  num_errors  = 0;
+    uint32_t  wait_idx;
+    uint32_t  thread_idx;
+
+    cctest_gate.num_threads = CC_TEST_GATE_NUM_THREADS;
+
+    for(thread_idx = 0 ; thread_idx < CC_TEST_GATE_NUM_THREADS ; thread_idx++)
+    {
+        if(pthread_create(&thread[thread_idx], NULL, ccTestGateThread, (void *)(uintptr_t)thread_idx) != 0)
+        {
+            printf("Error - ccTestGate: failed to create thread %u\n", thread_idx);
+            return(num_errors + 1);
+        }
+    }
+
+    // Every wait must be rounded to the nearest iteration and every thread must then run exactly that many iterations
+
+    for(wait_idx = 0 ; wait_idx < sizeof(waits) / sizeof(waits[0]) ; wait_idx++)
+    {
+        uint64_t num_iters = ccGateWaitIters(waits[wait_idx].wait_s);
+
+        if(num_iters != waits[wait_idx].num_iters)
+        {
+            if(num_errors++ < CC_TEST_MAX_REPORTED_ERRORS)
+            {
+                printf("Error - ccTestGate: a wait of %g s is %lu iterations instead of %lu\n",
+                       waits[wait_idx].wait_s, (unsigned long)num_iters, (unsigned long)waits[wait_idx].num_iters);
+            }
+        }
+
+        ccGateRunIters(&cctest_gate, num_iters);
+
+        total_iters += num_iters;
+
+        for(thread_idx = 0 ; thread_idx < CC_TEST_GATE_NUM_THREADS ; thread_idx++)
+        {
+            work = atomic_load(&cctest_gate_work[thread_idx]);
+
+            if(work != total_iters)
+            {
+                if(num_errors++ < CC_TEST_MAX_REPORTED_ERRORS)
+                {
+                    printf("Error - ccTestGate: thread %u ran %lu iterations instead of %lu\n",
+                           thread_idx, (unsigned long)work, (unsigned long)total_iters);
+                }
+            }
+        }
+    }
+
+    // The threads are left waiting at the gate
+
+    return(num_errors);
+}
+
+
+
+// Channel snapshot and libreg managers used by ccTestShm() and its threads
+
+static struct ccshm_chan    cctest_shm_chan;
+static struct REG_mgr       cctest_shm_reg_mgr[1 + CC_TEST_SHM_NUM_READERS];
+static atomic_bool          cctest_shm_writer_done;
+
+
+
+static void ccTestShmFill(struct REG_mgr *reg_mgr, uint64_t iter_counter)
+{
+    // Every variable takes a value derived from the iteration counter, so a snapshot that mixes
+    // two iterations can be detected
+
+#define CC_TEST_SHM_VAR(VAR_KEY, TYPE)   regMgrVarP(reg_mgr, VAR_KEY) = (TYPE)(iter_counter & 0xFFFF);
+    REG_VARS_LIST(CC_TEST_SHM_VAR)
+#undef CC_TEST_SHM_VAR
+}
+
+
+
+static void * ccTestShmWriterThread(void *arg)
+{
+    struct REG_mgr *reg_mgr = &cctest_shm_reg_mgr[0];
+    uint64_t        iter_counter;
+
+    for(iter_counter = 1 ; iter_counter <= CC_TEST_SHM_NUM_WRITES ; iter_counter++)
+    {
+        ccTestShmFill(reg_mgr, iter_counter);
+
+        ccShmWriteRT(&cctest_shm_chan, reg_mgr, iter_counter, iter_counter * 1.0E-3);
+    }
+
+    atomic_store(&cctest_shm_writer_done, true);
+
+    return(NULL);
+}
+
+
+
+static void * ccTestShmReaderThread(void *arg)
+{
+    uint32_t           reader_idx   = (uint32_t)(uintptr_t)arg;
+    struct REG_mgr    *reg_mgr      = &cctest_shm_reg_mgr[1 + reader_idx];
+    uint64_t           last_counter = 0;
+    uint32_t           num_reads    = 0;
+    uint32_t           num_errors   = 0;
+    struct ccshm_chan  copy;
+    bool               is_torn;
+
+    while(!atomic_load(&cctest_shm_writer_done))
+    {
+        ccShmRead(&cctest_shm_chan, &copy);
+
+        if(copy.iter_counter == 0)
+        {
+            continue;
+        }
+
+        num_reads++;
+
+        // The snapshot must match the iteration counter and must never go backwards
+
+        ccTestShmFill(reg_mgr, copy.iter_counter);
+
+        is_torn = copy.iter_time_s != copy.iter_counter * 1.0E-3;
+
+#define CC_TEST_SHM_VAR(VAR_KEY, TYPE)   is_torn |= copy.vars.VAR_KEY != regMgrVarP(reg_mgr, VAR_KEY);
+        REG_VARS_LIST(CC_TEST_SHM_VAR)
+#undef CC_TEST_SHM_VAR
+
+        if(is_torn || copy.iter_counter < last_counter)
+        {
+            if(num_errors++ < CC_TEST_MAX_REPORTED_ERRORS)
+            {
+                printf("Error - ccTestShm: reader %u snapshot %u at iteration %lu is %s\n", reader_idx, num_reads,
+                       (unsigned long)copy.iter_counter, is_torn ? "torn" : "older than the previous snapshot");
+            }
+        }
+
+        last_counter = copy.iter_counter;
+    }
+
+    if(num_reads == 0 && num_errors++ < CC_TEST_MAX_REPORTED_ERRORS)
+    {
+        printf("Error - ccTestShm: reader %u read no snapshots\n", reader_idx);
+    }
+
+    return((void *)(uintptr_t)num_errors);
+}
+
+
+
+static uint32_t ccTestShm(void)
+{
+    pthread_t   writer;
+    pthread_t   reader[CC_TEST_SHM_NUM_READERS];
+    bool        reader_started[CC_TEST_SHM_NUM_READERS];
+    void       *reader_errors;
+    uint32_t    num_errors = 0;
+    uint32_t    reader_idx;
+
+    for(reader_idx = 0 ; reader_idx < CC_TEST_SHM_NUM_READERS ; reader_idx++)
+    {
+        reader_started[reader_idx] = pthread_create(&reader[reader_idx], NULL, ccTestShmReaderThread,
+                                                    (void *)(uintptr_t)reader_idx) == 0;
+
+        if(reader_started[reader_idx] == false)
+        {
+            printf("Error - ccTestShm: failed to create reader thread %u\n", reader_idx);
+            num_errors++;
+        }
+    }
+
+    // The writer plays the role of the real-time thread that publishes the channel
+
+    if(pthread_create(&writer, NULL, ccTestShmWriterThread, NULL) != 0)
+    {
+        printf("Error - ccTestShm: failed to create the writer thread\n");
+        atomic_store(&cctest_shm_writer_done, true);
+        num_errors++;
+    }
+    else
+    {
+        pthread_join(writer, NULL);
+    }
+
+    for(reader_idx = 0 ; reader_idx < CC_TEST_SHM_NUM_READERS ; reader_idx++)
+    {
+        if(reader_started[reader_idx])
+        {
+            pthread_join(reader[reader_idx], &reader_errors);
+
+            num_errors += (uint32_t)(uintptr_t)reader_errors;
+        }
+    }
+
+    return(num_errors);
+}
+
+
+
+static struct cctest tests[] =
+{
+    { "ccTimelineRT",               ccTestTimeline              },
+    { "ccGateRunIters",             ccTestGate                  },
+    { "ccShmRead",                  ccTestShm                   },
+    { NULL }
+};
+
+
+
+int main(int argc, char **argv)
+{
+    struct cctest *test;
+    uint32_t       num_errors;
+    uint32_t       num_failed_tests = 0;
+
+    for(test = tests ; test->name != NULL ; test++)
+    {
+        num_errors = test->check();
+
+        printf("%-32s %s (%u errors)\n", test->name, num_errors == 0 ? "passed" : "FAILED", num_errors);
+
+        if(num_errors != 0)
+        {
+            num_failed_tests++;
+        }
+    }
+
+    return(num_failed_tests == 0 ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+// EOF
@@ -0,0 +1,194 @@
+/*!
+ * @file  ccrt/tools/ccshm.c
+ *
+ * @brief Reader for the ccrt shared memory telemetry segment
+ *
+ * Usage: ccshm [-c channel] [-p period_ms] [-n num_samples] shm_name [var_key ...]
+ *
+ * ccshm maps the segment created by ccrt -m shm_name read-only and prints the libreg variables
+ * of one channel. If variable keys (e.g. I_MEAS, V_REF) are given, only those variables are
+ * printed, otherwise all of them. By default one snapshot is printed. With -p, snapshots are
+ * printed every period_ms until num_samples have been printed (0 = forever).
+ *
+ * <h2>Copyright</h2>
+ *
+ * Copyright CERN 2015. This project is released under the GNU Lesser General
+ * Public License version 3.
+ *
+ * <h2>License</h2>
+ *
+ * This file is part of ccrt.
+ *
+ * ccrt is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include "ccShm.h"
+
+// Static variables
+
+static char           **var_keys;               // Variable keys from the command line
+static int              num_var_keys;           // Number of variable keys (0 = print all variables)
+
+
+
+/*!
+ * Check if a variable was selected on the command line.
+ *
+ * @param[in]  var_key     Variable key, e.g. "I_MEAS"
+ *
+ * @retval     true        Variable should be printed
+ * @retval     false       Variable should not be printed
+ */
+static bool ccshmIsSelected(char const *var_key)
+{
+    int i;
+
+    if(num_var_keys == 0)
+    {
+        return(true);
+    }
+
+    for(i = 0 ; i < num_var_keys ; i++)
+    {
+        if(strcasecmp(var_key, var_keys[i]) == 0)
+        {
+            return(true);
+        }
+    }
+
+    return(false);
+}
+
+
+
+/*!
+ * Print one snapshot of the selected variables of a channel.
+ *
+ * @param[in]  shm_chan    Pointer to the channel in the shared memory segment
+ */
+static void ccshmPrint(struct ccshm_chan const *shm_chan)
+{
+    struct ccshm_chan copy;
+    uint32_t          num_retries;
+
+    num_retries = ccShmRead(shm_chan, &copy);
+
+    printf("ITER_COUNTER                   %llu\n", (unsigned long long)copy.iter_counter);
+    printf("ITER_TIME                      %.6f\n", copy.iter_time_s);
+    printf("SEQ                            %u (%u retries)\n", copy.seq, num_retries);
+
+#define CC_SHM_VAR(VAR_KEY, TYPE)   if(ccshmIsSelected(#VAR_KEY)) printf("%-30s %.7E\n", #VAR_KEY, (double)copy.vars.VAR_KEY);
+    REG_VARS_LIST(CC_SHM_VAR)
+#undef CC_SHM_VAR
+
+    putchar('\n');
+}
+
+
+
+int main(int argc, char **argv)
+{
+    struct ccshm_segment const *segment;
+    uint32_t    chan_idx    = 0;
+    uint32_t    period_ms   = 0;
+    uint32_t    num_samples = 1;
+    uint32_t    sample_idx;
+    int         option;
+    int         fd;
+
+    while((option = getopt(argc, argv, "c:p:n:")) != -1)
+    {
+        switch(option)
+        {
+            case 'c': chan_idx    = strtoul(optarg, NULL, 10); break;
+            case 'p': period_ms   = strtoul(optarg, NULL, 10); num_samples = 0; break;
+            case 'n': num_samples = strtoul(optarg, NULL, 10); break;
+            default:
+
+                printf("usage: %s [-c channel] [-p period_ms] [-n num_samples] shm_name [var_key ...]\n", argv[0]);
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    if(optind >= argc)
+    {
+        printf("usage: %s [-c channel] [-p period_ms] [-n num_samples] shm_name [var_key ...]\n", argv[0]);
+        exit(EXIT_FAILURE);
+    }
+
+    var_keys     = &argv[optind + 1];
+    num_var_keys = argc - optind - 1;
+
+    // Map the segment read-only
+
+    fd = shm_open(argv[optind], O_RDONLY, 0);
+
+    if(fd < 0)
+    {
+        printf("Error - failed to open shared memory segment %s : %s\n", argv[optind], strerror(errno));
+        exit(EXIT_FAILURE);
+    }
+
+    segment = mmap(NULL, sizeof(struct ccshm_segment), PROT_READ, MAP_SHARED, fd, 0);
+
+    close(fd);
+
+    if(segment == MAP_FAILED)
+    {
+        printf("Error - failed to map shared memory segment %s : %s\n", argv[optind], strerror(errno));
+        exit(EXIT_FAILURE);
+    }
+
+    // Check that the segment was written by a ccrt with the same layout
+
+    if(segment->magic     != CC_SHM_MAGIC   ||
+       segment->version   != CC_SHM_VERSION ||
+       segment->num_vars  != REG_NUM_VARS   ||
+       segment->vars_size != sizeof(struct ccshm_vars))
+    {
+        printf("Error - shared memory segment %s is not initialised or has an incompatible layout\n", argv[optind]);
+        exit(EXIT_FAILURE);
+    }
+
+    if(chan_idx >= segment->num_channels)
+    {
+        printf("Error - channel %u is not valid (channels 0-%u)\n", chan_idx, segment->num_channels - 1);
+        exit(EXIT_FAILURE);
+    }
+
+    // Print snapshots
+
+    for(sample_idx = 0 ; num_samples == 0 || sample_idx < num_samples ; sample_idx++)
+    {
+        if(sample_idx > 0)
+        {
+            usleep(period_ms * 1000);
+        }
+
+        ccshmPrint(&segment->chan[chan_idx]);
+    }
+
+    exit(EXIT_SUCCESS);
+}
+
+// EOF
@@ -0,0 +1,35 @@
+/*---------------------------------------------------------------------------------------------------------*\
+  File:     cctest/inc/ccCheck.h                                                         Copyright CERN 2015
+
+  License:  This file is part of cctest.
+
+            cctest is free software: you can redistribute it and/or modify
+            it under the terms of the GNU Lesser General Public License as published by
+            the Free Software Foundation, either version 3 of the License, or
+            (at your option) any later version.
+
+            This program is distributed in the hope that it will be useful,
+            but WITHOUT ANY WARRANTY; without even the implied warranty of
+            MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+            GNU Lesser General Public License for more details.
+
+            You should have received a copy of the GNU Lesser General Public License
+            along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  Purpose:  Header file for ccCheck.c
+
+  Authors:  Quentin.King@cern.ch
+\*---------------------------------------------------------------------------------------------------------*/
+
+#ifndef CCCHECK_H
+#define CCCHECK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Function declarations
+
+uint32_t ccCheckRun             (bool bench);
+
+#endif
+// EOF
@@ -82,6 +82,7 @@ uint32_t ccCmdsRead  (uint32_t cmd_idx, char *remaining_line);
 uint32_t ccCmdsSave  (uint32_t cmd_idx, char *remaining_line);
 uint32_t ccCmdsDebug (uint32_t cmd_idx, char *remaining_line);
 uint32_t ccCmdsRun   (uint32_t cmd_idx, char *remaining_line);
+uint32_t ccCmdsCheck (uint32_t cmd_idx, char *remaining_line);
 uint32_t ccCmdsPar   (uint32_t cmd_idx, char *remaining_line);
 uint32_t ccCmdsExit  (uint32_t cmd_idx, char *remaining_line);
 uint32_t ccCmdsQuit  (uint32_t cmd_idx, char *remaining_line);
@@ -117,6 +118,7 @@ enum cccmds_enum
     CMD_SAVE,
     CMD_DEBUG,
     CMD_RUN,
+    CMD_CHECK,
     CMD_EXIT,
     CMD_QUIT,
 
@@ -164,6 +166,7 @@ CCCMDS_EXT struct cccmds cmds[] // The order must match enum cccmds_enum (above)
     { "SAVE",    ccCmdsSave , NULL        , "filename   Save all parameters in named file"                      },
     { "DEBUG",   ccCmdsDebug, NULL        , "           Print all debug variables"                              },
     { "RUN",     ccCmdsRun  , NULL        , "           Run function generation test or converter simulation"   },
+    { "CHECK",   ccCmdsCheck, NULL        , "[BENCH]    Run the library self checks and optionally the benchmarks"  },
     { "EXIT",    ccCmdsExit , NULL        , "           Exit from current file or quit when from stdin"         },
     { "QUIT",    ccCmdsQuit , NULL        , "           Quit program immediately"                               },
     { NULL }
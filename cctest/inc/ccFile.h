@@ -67,6 +67,8 @@ CCFILE_EXT struct ccfile ccfile;
 // Function declarations
 
 uint32_t ccFileReadAll          (void);
+char   * ccFileMap              (char *path, size_t *buf_len);
+void     ccFileUnmap            (char *buf, size_t buf_len);
 uint32_t ccFileMakePath         (char *path);
 void     ccFileRecoverPath      (void);
 void     ccFileGetBasePath      (char *argv0);
@@ -40,6 +40,7 @@ uint32_t ccParseParName         (uint32_t cmd_idx, char **remaining_line, struct
 char    *ccParseNextArg         (char **remaining_line);
 char    *ccParseAbbreviateArg   (char *arg);
 uint32_t ccParseNoMoreArgs      (char **remaining_line);
+double   ccParseFloat           (char *arg, char **remaining_arg);
 
 #endif
 // EOF
@@ -32,6 +32,10 @@
 #define CCREF_EXT extern
 #endif
 
+// Constants
+
+#define CC_CHECK_MAX_THREADS    8               // Max number of threads used by ccRefCheckFunc()
+
 // Function prototypes
 
 enum FG_func_status ccRefDirectRT    (union  FG_pars *pars, FG_float func_time, float *ref);
@@ -47,6 +51,7 @@ enum FG_errno       ccRefInitCOSINE  (struct FG_error *fg_error, uint32_t cyc_se
 enum FG_errno       ccRefInitLTRIM   (struct FG_error *fg_error, uint32_t cyc_sel);
 enum FG_errno       ccRefInitCTRIM   (struct FG_error *fg_error, uint32_t cyc_sel);
 enum FG_errno       ccRefInitPULSE   (struct FG_error *fg_error, uint32_t cyc_sel);
+enum FG_errno       ccRefCheckFunc   (FG_FuncRT fg_func, struct FG_error *fg_error, uint32_t cyc_sel);
 
 // Reference functions structure
 
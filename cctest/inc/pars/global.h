@@ -66,6 +66,7 @@ struct CCpars_global
     float                       dyn_eco_time[2];            // Start/end time since start of function for dynamic economy
     enum REG_err_rate           reg_err_rate;               // Regulation error rate control
     enum REG_enabled_disabled   fg_limits;                  // Enable limits for function generator initialisation
+    enum REG_enabled_disabled   fg_check;                   // Enable validation of every sample of armed functions against the limits
     enum REG_enabled_disabled   sim_load;                   // Enable load simulation
     enum REG_enabled_disabled   stop_on_error;              // Enable stop on error - this will stop reading the file
     enum REG_enabled_disabled   csv_output;                 // CSV  format output control (ENABLED or DISABLED)
@@ -91,6 +92,7 @@ CCPARS_GLOBAL_EXT struct CCpars_global ccpars_global
        { 0.0, 0.0 }           ,   // GLOBAL DYN_ECO_TIME
        REG_ERR_RATE_REGULATION,   // GLOBAL REG_ERR_RATE
        REG_DISABLED           ,   // GLOBAL FG_LIMITS
+       REG_DISABLED           ,   // GLOBAL FG_CHECK
        REG_DISABLED           ,   // GLOBAL SIM_LOAD
        REG_ENABLED            ,   // GLOBAL STOP_ON_ERROR
        REG_DISABLED           ,   // GLOBAL CSV_FORMAT
@@ -116,6 +118,7 @@ enum global_pars_index_enum
     GLOBAL_DYN_ECO_TIME      ,
     GLOBAL_REG_ERR_RATE      ,
     GLOBAL_FG_LIMITS         ,
+    GLOBAL_FG_CHECK          ,
     GLOBAL_SIM_LOAD          ,
     GLOBAL_STOP_ON_ERROR     ,
     GLOBAL_CSV_OUTPUT        ,
@@ -141,6 +144,7 @@ CCPARS_GLOBAL_EXT struct CCpars global_pars[]
     { "DYN_ECO_TIME",    PAR_FLOAT,    2,          NULL,                  { .f =  ccpars_global.dyn_eco_time     }, 2, 0, PARS_FIXED_LENGTH },
     { "REG_ERR_RATE",    PAR_ENUM,     1,          enum_reg_err_rate,     { .u = &ccpars_global.reg_err_rate     }, 1, 0, 0                 },
     { "FG_LIMITS",       PAR_ENUM,     1,          enum_enabled_disabled, { .u = &ccpars_global.fg_limits        }, 1, 0, 0                 },
+    { "FG_CHECK",        PAR_ENUM,     1,          enum_enabled_disabled, { .u = &ccpars_global.fg_check         }, 1, 0, 0                 },
     { "SIM_LOAD",        PAR_ENUM,     1,          enum_enabled_disabled, { .u = &ccpars_global.sim_load         }, 1, 0, 0                 },
     { "STOP_ON_ERROR",   PAR_ENUM,     1,          enum_enabled_disabled, { .u = &ccpars_global.stop_on_error    }, 1, 0, 0                 },
     { "CSV_OUTPUT",      PAR_ENUM,     1,          enum_enabled_disabled, { .u = &ccpars_global.csv_output       }, 1, 0, 0                 },
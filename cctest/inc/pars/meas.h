@@ -47,6 +47,19 @@ CCPARS_MEAS_EXT struct CCpars_enum enum_reg_meas_select[]
 #endif
 ;
 
+// General measurement filter stage selector
+
+CCPARS_MEAS_EXT struct CCpars_enum enum_reg_meas_gen_filter[]
+#ifdef GLOBALS
+= {
+    { REG_MEAS_GEN_FILTER_NONE, "NONE" },
+    { REG_MEAS_GEN_FILTER_FIR,  "FIR"  },
+    { REG_MEAS_GEN_FILTER_IIR,  "IIR"  },
+    { 0,                        NULL   },
+}
+#endif
+;
+
 // Meas parameters structure
 
 struct CCpars_meas
@@ -61,6 +74,16 @@ struct CCpars_meas
     uint32_t                b_fir_lengths[2];           // Field   measurement FIR filter lengths (in iterations)
     uint32_t                i_fir_lengths[2];           // Current measurement FIR filter lengths (in iterations)
 
+    uint32_t                b_rate_window;              // Field   measurement rate regression window (in regulation periods)
+    uint32_t                i_rate_window;              // Current measurement rate regression window (in regulation periods)
+
+    enum REG_meas_gen_filter b_gen_filter;              // Field   measurement general filter stage type
+    enum REG_meas_gen_filter i_gen_filter;              // Current measurement general filter stage type
+    uint32_t                b_gen_filter_num_coeffs;    // Field   measurement general filter number of coefficients
+    uint32_t                i_gen_filter_num_coeffs;    // Current measurement general filter number of coefficients
+    float                   b_gen_filter_coeffs[REG_MEAS_GEN_FILTER_MAX_COEFFS]; // Field   measurement general filter coefficients
+    float                   i_gen_filter_coeffs[REG_MEAS_GEN_FILTER_MAX_COEFFS]; // Current measurement general filter coefficients
+
     float                   b_sim_noise_pp;             // Simulated field   measurement peak-peak noise level
     float                   i_sim_noise_pp;             // Simulated current measurement peak-peak noise level
     float                   v_sim_noise_pp;             // Simulated voltage measurement peak-peak noise level
@@ -86,6 +109,14 @@ CCPARS_MEAS_EXT struct CCpars_meas ccpars_meas
         1.3,                     // MEAS V_DELAY_ITERS
         { 0, 0 },                // MEAS B_FIR_LENGTHS
         { 0, 0 },                // MEAS I_FIR_LENGTHS
+        4,                       // MEAS B_RATE_WINDOW
+        4,                       // MEAS I_RATE_WINDOW
+        REG_MEAS_GEN_FILTER_NONE,// MEAS B_GEN_FILTER
+        REG_MEAS_GEN_FILTER_NONE,// MEAS I_GEN_FILTER
+        0,                       // MEAS B_GEN_FILTER_NUM_COEFFS
+        0,                       // MEAS I_GEN_FILTER_NUM_COEFFS
+        { 0.0 },                 // MEAS B_GEN_FILTER_COEFFS
+        { 0.0 },                 // MEAS I_GEN_FILTER_COEFFS
         0.0,                     // MEAS B_SIM_NOISE_PP
         0.0,                     // MEAS I_SIM_NOISE_PP
         0.0,                     // MEAS V_SIM_NOISE_PP
@@ -112,6 +143,14 @@ CCPARS_MEAS_EXT struct CCpars meas_pars[]
     { "V_DELAY_ITERS",          PAR_FLOAT,     1,     NULL,                 { .f = &ccpars_meas.v_delay_iters         }, 1, 0, 0                 },
     { "B_FIR_LENGTHS",          PAR_UNSIGNED,  2,     NULL,                 { .u =  ccpars_meas.b_fir_lengths         }, 2, 0, PARS_FIXED_LENGTH },
     { "I_FIR_LENGTHS",          PAR_UNSIGNED,  2,     NULL,                 { .u =  ccpars_meas.i_fir_lengths         }, 2, 0, PARS_FIXED_LENGTH },
+    { "B_RATE_WINDOW",          PAR_UNSIGNED,  1,     NULL,                 { .u = &ccpars_meas.b_rate_window         }, 1, 0, 0                 },
+    { "I_RATE_WINDOW",          PAR_UNSIGNED,  1,     NULL,                 { .u = &ccpars_meas.i_rate_window         }, 1, 0, 0                 },
+    { "B_GEN_FILTER",           PAR_ENUM,      1,     enum_reg_meas_gen_filter, { .u = &ccpars_meas.b_gen_filter      }, 1, 0, 0                 },
+    { "I_GEN_FILTER",           PAR_ENUM,      1,     enum_reg_meas_gen_filter, { .u = &ccpars_meas.i_gen_filter      }, 1, 0, 0                 },
+    { "B_GEN_FILTER_NUM_COEFFS",PAR_UNSIGNED,  1,     NULL,                 { .u = &ccpars_meas.b_gen_filter_num_coeffs }, 1, 0, 0               },
+    { "I_GEN_FILTER_NUM_COEFFS",PAR_UNSIGNED,  1,     NULL,                 { .u = &ccpars_meas.i_gen_filter_num_coeffs }, 1, 0, 0               },
+    { "B_GEN_FILTER_COEFFS",    PAR_FLOAT,     REG_MEAS_GEN_FILTER_MAX_COEFFS, NULL, { .f = ccpars_meas.b_gen_filter_coeffs }, 0, 0, 0          },
+    { "I_GEN_FILTER_COEFFS",    PAR_FLOAT,     REG_MEAS_GEN_FILTER_MAX_COEFFS, NULL, { .f = ccpars_meas.i_gen_filter_coeffs }, 0, 0, 0          },
     { "B_SIM_NOISE_PP",         PAR_FLOAT,     1,     NULL,                 { .f = &ccpars_meas.b_sim_noise_pp        }, 1, 0, 0                 },
     { "I_SIM_NOISE_PP",         PAR_FLOAT,     1,     NULL,                 { .f = &ccpars_meas.i_sim_noise_pp        }, 1, 0, 0                 },
     { "V_SIM_NOISE_PP",         PAR_FLOAT,     1,     NULL,                 { .f = &ccpars_meas.v_sim_noise_pp        }, 1, 0, 0                 },
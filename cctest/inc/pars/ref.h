@@ -131,6 +131,7 @@ CCPARS_REF_EXT struct CCpars_enum enum_fg_error[]
     { FG_OUT_OF_LIMITS,              "OUT_OF_LIMITS"              },
     { FG_OUT_OF_RATE_LIMITS,         "OUT_OF_RATE_LIMITS"         },
     { FG_OUT_OF_ACCELERATION_LIMITS, "OUT_OF_ACCELERATION_LIMITS" },
+    { FG_DISCONTINUITY,              "DISCONTINUITY"              },
     { 0,                              NULL                        },
 }
 #endif